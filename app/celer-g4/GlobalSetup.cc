@@ -183,6 +183,10 @@ void GlobalSetup::ReadInput(std::string const& filename)
         options_->initializer_capacity = input_.initializer_capacity;
         options_->secondary_stack_factor = input_.secondary_stack_factor;
         options_->auto_flush = input_.auto_flush;
+        options_->suspend_steps = input_.suspend_steps;
+        options_->num_shared_streams = input_.num_shared_streams;
+        options_->merge_threshold = input_.merge_threshold;
+        options_->shared_timeout = input_.shared_timeout;
 
         options_->max_field_substeps = input_.field_options.max_substeps;
 
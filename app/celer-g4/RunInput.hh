@@ -79,6 +79,10 @@ struct RunInput
     size_type initializer_capacity{};
     real_type secondary_stack_factor{};
     size_type auto_flush{};  //!< Defaults to num_track_slots
+    size_type suspend_steps{};  //!< Iterations before deferring stragglers
+    size_type num_shared_streams{};  //!< Streams shared by worker threads
+    real_type merge_threshold{0.5};  //!< Active fraction to merge offloads
+    real_type shared_timeout{};  //!< Seconds before a shared offload fails
 
     bool action_times{false};
     bool default_stream{false};  //!< Launch all kernels on the default stream
@@ -98,6 +98,10 @@ void from_json(nlohmann::json const& j, RunInput& v)
     {
         v.auto_flush = v.num_track_slots;
     }
+    RI_LOAD_OPTION(suspend_steps);
+    RI_LOAD_OPTION(num_shared_streams);
+    RI_LOAD_OPTION(merge_threshold);
+    RI_LOAD_OPTION(shared_timeout);
 
     RI_LOAD_OPTION(track_order);
 
@@ -195,6 +199,10 @@ void to_json(nlohmann::json& j, RunInput const& v)
     RI_SAVE(action_times);
     RI_SAVE(default_stream);
     RI_SAVE(auto_flush);
+    RI_SAVE(suspend_steps);
+    RI_SAVE(num_shared_streams);
+    RI_SAVE(merge_threshold);
+    RI_SAVE(shared_timeout);
 
     RI_SAVE(track_order);
 
@@ -18,6 +18,7 @@
 #    include <omp.h>
 #endif
 
+#include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/OutputRegistry.hh"
@@ -42,6 +43,7 @@
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/TelemetryWriter.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/io/EventReader.hh"
@@ -63,6 +65,7 @@
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/WeightWindowAction.hh"
 #include "celeritas/user/ActionDiagnostic.hh"
 #include "celeritas/user/RootStepWriter.hh"
 #include "celeritas/user/SimpleCalo.hh"
@@ -211,6 +214,67 @@ auto Runner::operator()() -> RunnerResult
     return transport(make_span(events_.front()));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Gather suspended tracks from all streams into batches.
+ *
+ * This must be called from a single thread after all events have been
+ * started. Stragglers from all events are combined into as few batches as
+ * possible (but no more than the number of streams) so that they run at high
+ * occupancy. The tracks are dealt to the batches in turn so that each batch
+ * gets a similar mix of tracks in flight and initializers.
+ *
+ * \return Number of batches to transport
+ */
+size_type Runner::gather_suspended()
+{
+    SuspendedTracks all;
+    for (auto& transport : transporters_)
+    {
+        if (transport)
+        {
+            all.merge(transport->take_suspended());
+        }
+    }
+
+    suspended_.clear();
+    if (all.empty())
+    {
+        return 0;
+    }
+
+    size_type num_batches = std::min<size_type>(
+        this->num_streams(),
+        ceil_div<size_type>(all.size(), transporter_input_->num_track_slots));
+    suspended_.resize(num_batches);
+    for (auto i : range(all.size()))
+    {
+        suspended_[i % num_batches].tracks.push_back(all.tracks[i]);
+    }
+    for (auto& batch : suspended_)
+    {
+        batch.track_counters = all.track_counters;
+    }
+
+    CELER_LOG(status) << "Gathered " << all.size()
+                      << " suspended tracks into " << num_batches
+                      << " batches";
+    return num_batches;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport a batch of suspended tracks on a single stream.
+ */
+auto Runner::resume(StreamId stream, size_type batch) -> RunnerResult
+{
+    CELER_EXPECT(stream < this->num_streams());
+    CELER_EXPECT(batch < suspended_.size());
+
+    auto& transport = this->get_transporter(stream);
+    return transport(std::move(suspended_[batch]));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Number of streams supported.
@@ -439,6 +503,12 @@ void Runner::build_core_params(RunnerInput const& inp,
     }();
 
     core_params_ = std::make_shared<CoreParams>(std::move(params));
+
+    if (inp.weight_window)
+    {
+        // Add before step collectors so they see the adjusted weights
+        WeightWindowAction::make_and_insert(*core_params_, inp.weight_window);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -456,10 +526,21 @@ void Runner::build_transporter_input(RunnerInput const& inp)
     transporter_input_->num_track_slots
         = ceil_div(inp.num_track_slots, core_params_->max_streams());
     transporter_input_->max_steps = inp.max_steps;
+    transporter_input_->suspend_steps = inp.suspend_steps;
     transporter_input_->store_track_counts = inp.write_track_counts;
     transporter_input_->store_step_times = inp.write_step_times;
     transporter_input_->action_times = inp.action_times;
     transporter_input_->params = core_params_;
+
+    if (!inp.telemetry_file.empty())
+    {
+        auto telemetry = std::make_shared<TelemetryWriter>(
+            inp.telemetry_file,
+            inp.telemetry_interval,
+            core_params_->max_streams());
+        core_params_->output_reg()->insert(telemetry);
+        transporter_input_->telemetry = std::move(telemetry);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -596,7 +677,16 @@ void Runner::build_optical_collector(RunnerInput const& inp,
 
     OpticalCollector::Input oc_inp;
     oc_inp.material = MaterialParams::from_import(
-        imported, *core_params_->geomaterial(), *core_params_->material());
+        imported,
+        *core_params_->geometry(),
+        *core_params_->geomaterial(),
+        *core_params_->material(),
+        [&inp] {
+            MaterialParams::ImportOptions opts;
+            opts.survival_probability = inp.optical.survival_probability;
+            opts.kill_volumes = inp.optical.kill_volumes;
+            return opts;
+        }());
     oc_inp.cerenkov = std::make_shared<CerenkovParams>(oc_inp.material);
     oc_inp.scintillation
         = ScintillationParams::from_import(imported, core_params_->particle());
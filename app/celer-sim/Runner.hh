@@ -66,6 +66,12 @@ class Runner
     // Run all events simultaneously on a single stream
     RunnerResult operator()();
 
+    // Gather suspended tracks from all streams into batches
+    size_type gather_suspended();
+
+    // Transport a batch of suspended tracks on a single stream
+    RunnerResult resume(StreamId, size_type batch);
+
     // Number of streams supported
     StreamId::size_type num_streams() const;
 
@@ -95,6 +101,7 @@ class Runner
     std::shared_ptr<TransporterInput> transporter_input_;
     VecEvent events_;
     std::vector<UPTransporterBase> transporters_;
+    std::vector<SuspendedTracks> suspended_;
 
     //// HELPER FUNCTIONS ////
 
@@ -7,6 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "corecel/Config.hh"
 
 #include "corecel/Macros.hh"
@@ -19,6 +23,7 @@
 #include "celeritas/ext/RootFileManager.hh"
 #include "celeritas/field/FieldDriverOptions.hh"
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
+#include "celeritas/track/WeightWindowOptions.hh"
 #include "celeritas/user/RootStepWriter.hh"
 
 #ifdef _WIN32
@@ -57,6 +62,10 @@ struct RunnerInput
         size_type primary_capacity{};  //!< Maximum number of pending primaries
         size_type auto_flush{};  //!< Threshold number of primaries for
                                  //!< launching optical tracking loop
+        //! Fraction of generated photons to track, by material name
+        std::map<std::string, real_type> survival_probability;
+        //! Names of volumes in which optical photons are killed
+        std::vector<std::string> kill_volumes;
 
         explicit operator bool() const
         {
@@ -95,11 +104,14 @@ struct RunnerInput
     std::string slot_diagnostic_prefix;  //!< Base name for slot diagnostic
     bool write_track_counts{true};  //!< Output track counts for each step
     bool write_step_times{true};  //!< Output elapsed times for each step
+    std::string telemetry_file;  //!< File or "unix:" socket for snapshots
+    double telemetry_interval{60};  //!< Seconds between telemetry snapshots
 
     // Control
     unsigned int seed{};
     size_type num_track_slots{};  //!< Divided among streams
     size_type max_steps = static_cast<size_type>(-1);
+    size_type suspend_steps{};  //!< Iterations before deferring stragglers
     size_type initializer_capacity{};  //!< Divided among streams
     real_type secondary_stack_factor{};
     bool use_device{};
@@ -119,6 +131,9 @@ struct RunnerInput
     // Options for physics
     bool brem_combined{false};
 
+    // Optional weight window for variance reduction
+    WeightWindowOptions weight_window;
+
     // Track reordering options
     TrackOrder track_order{TrackOrder::none};
 
@@ -136,7 +151,9 @@ struct RunnerInput
                && num_track_slots > 0 && max_steps > 0
                && initializer_capacity > 0 && secondary_stack_factor > 0
                && (step_diagnostic_bins > 0 || !step_diagnostic)
-               && (field == no_field() || field_options);
+               && (telemetry_interval > 0 || telemetry_file.empty())
+               && (field == no_field() || field_options)
+               && (weight_window.threshold.empty() || weight_window);
     }
 };
 
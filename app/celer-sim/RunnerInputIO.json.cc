@@ -22,6 +22,7 @@
 #include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/field/FieldDriverOptionsIO.json.hh"
 #include "celeritas/phys/PrimaryGeneratorOptionsIO.json.hh"
+#include "celeritas/track/WeightWindowOptionsIO.json.hh"
 #include "celeritas/user/RootStepWriterIO.json.hh"
 
 namespace celeritas
@@ -79,6 +80,8 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(slot_diagnostic_prefix);
     LDIO_LOAD_OPTION(write_track_counts);
     LDIO_LOAD_OPTION(write_step_times);
+    LDIO_LOAD_OPTION(telemetry_file);
+    LDIO_LOAD_OPTION(telemetry_interval);
 
     LDIO_LOAD_DEPRECATED(max_num_tracks, num_track_slots);
     LDIO_LOAD_DEPRECATED(sync, action_times);
@@ -86,6 +89,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(seed);
     LDIO_LOAD_OPTION(num_track_slots);
     LDIO_LOAD_OPTION(max_steps);
+    LDIO_LOAD_OPTION(suspend_steps);
     LDIO_LOAD_REQUIRED(initializer_capacity);
     LDIO_LOAD_REQUIRED(secondary_stack_factor);
     LDIO_LOAD_REQUIRED(use_device);
@@ -110,6 +114,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
 
     LDIO_LOAD_OPTION(step_limiter);
     LDIO_LOAD_OPTION(brem_combined);
+    LDIO_LOAD_OPTION(weight_window);
     if (auto iter = j.find("track_order"); iter != j.end())
     {
         iter->get_to(v.track_order);
@@ -177,10 +182,13 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_OPTION(slot_diagnostic_prefix);
     LDIO_SAVE(write_track_counts);
     LDIO_SAVE(write_step_times);
+    LDIO_SAVE_OPTION(telemetry_file);
+    LDIO_SAVE_WHEN(telemetry_interval, !v.telemetry_file.empty());
 
     LDIO_SAVE(seed);
     LDIO_SAVE(num_track_slots);
     LDIO_SAVE_OPTION(max_steps);
+    LDIO_SAVE_OPTION(suspend_steps);
     LDIO_SAVE(initializer_capacity);
     LDIO_SAVE(secondary_stack_factor);
     LDIO_SAVE(use_device);
@@ -194,6 +202,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
 
     LDIO_SAVE_OPTION(step_limiter);
     LDIO_SAVE(brem_combined);
+    LDIO_SAVE_WHEN(weight_window, static_cast<bool>(v.weight_window));
 
     LDIO_SAVE(track_order);
     LDIO_SAVE_WHEN(physics_options,
@@ -228,6 +237,8 @@ void from_json(nlohmann::json const& j, app::RunnerInput::OpticalOptions& oo)
     CELER_JSON_LOAD_REQUIRED(j, oo, buffer_capacity);
     CELER_JSON_LOAD_REQUIRED(j, oo, primary_capacity);
     CELER_JSON_LOAD_REQUIRED(j, oo, auto_flush);
+    CELER_JSON_LOAD_OPTION(j, oo, survival_probability);
+    CELER_JSON_LOAD_OPTION(j, oo, kill_volumes);
 }
 
 void to_json(nlohmann::json& j, app::RunnerInput::OpticalOptions const& oo)
@@ -236,6 +247,8 @@ void to_json(nlohmann::json& j, app::RunnerInput::OpticalOptions const& oo)
         CELER_JSON_PAIR(oo, buffer_capacity),
         CELER_JSON_PAIR(oo, primary_capacity),
         CELER_JSON_PAIR(oo, auto_flush),
+        CELER_JSON_PAIR(oo, survival_probability),
+        CELER_JSON_PAIR(oo, kill_volumes),
     };
 }
 
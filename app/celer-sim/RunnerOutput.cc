@@ -48,7 +48,10 @@ void RunnerOutput::output(JsonPimpl* j) const
     auto num_tracks = json::array();
     auto num_steps = json::array();
     auto num_aborted = json::array();
+    auto num_suspended = json::array();
     auto max_queued = json::array();
+    auto max_spilled = json::array();
+    auto max_secondaries = json::array();
     auto step_times = json::array();
 
     for (auto const& event : result_.events)
@@ -65,7 +68,10 @@ void RunnerOutput::output(JsonPimpl* j) const
         num_tracks.push_back(event.num_tracks);
         num_steps.push_back(event.num_steps);
         num_aborted.push_back(event.num_aborted);
+        num_suspended.push_back(event.num_suspended);
         max_queued.push_back(event.max_queued);
+        max_spilled.push_back(event.max_spilled);
+        max_secondaries.push_back(event.max_secondaries);
         if (!event.step_times.empty())
         {
             step_times.push_back(event.step_times);
@@ -87,6 +93,26 @@ void RunnerOutput::output(JsonPimpl* j) const
         step_times = nullptr;
     }
 
+    json resumed = nullptr;
+    if (!result_.resumed.empty())
+    {
+        // Suspended tracks were transported in separate batches
+        auto batch_step_iterations = json::array();
+        auto batch_steps = json::array();
+        auto batch_aborted = json::array();
+        for (auto const& batch : result_.resumed)
+        {
+            batch_step_iterations.push_back(batch.num_step_iterations);
+            batch_steps.push_back(batch.num_steps);
+            batch_aborted.push_back(batch.num_aborted);
+        }
+        resumed = json::object({
+            {"num_step_iterations", std::move(batch_step_iterations)},
+            {"num_steps", std::move(batch_steps)},
+            {"num_aborted", std::move(batch_aborted)},
+        });
+    }
+
     auto times = json::object({
         {"steps", std::move(step_times)},
         {"actions", result_.action_times},
@@ -106,8 +132,12 @@ void RunnerOutput::output(JsonPimpl* j) const
          {"num_tracks", std::move(num_tracks)},
          {"num_steps", std::move(num_steps)},
          {"num_aborted", std::move(num_aborted)},
+         {"num_suspended", std::move(num_suspended)},
          {"max_queued", std::move(max_queued)},
+         {"max_spilled", std::move(max_spilled)},
+         {"max_secondaries", std::move(max_secondaries)},
          {"num_streams", result_.num_streams},
+         {"resumed", std::move(resumed)},
          {"time", std::move(times)}});
 
     j->obj = std::move(obj);
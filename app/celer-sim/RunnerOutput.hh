@@ -32,6 +32,7 @@ struct SimulationResult
     double warmup_time{};  //!< One-time warmup cost
     MapStrDouble action_times{};  //!< Accumulated mean action wall times
     std::vector<TransporterResult> events;  //!< Results tallied for each event
+    std::vector<TransporterResult> resumed;  //!< Results for straggler batches
     size_type num_streams{};  //!< Number of CPU/OpenMP threads
 };
 
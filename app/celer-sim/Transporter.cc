@@ -26,6 +26,7 @@
 #include "celeritas/global/ActionSequence.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/Stepper.hh"
+#include "celeritas/global/TelemetryWriter.hh"
 #include "celeritas/phys/Model.hh"
 
 #include "StepTimer.hh"
@@ -45,11 +46,16 @@ TransporterBase::~TransporterBase() = default;
 template<MemSpace M>
 Transporter<M>::Transporter(TransporterInput inp)
     : max_steps_(inp.max_steps)
+    , suspend_steps_(inp.suspend_steps)
     , num_streams_(inp.params->max_streams())
     , store_track_counts_(inp.store_track_counts)
     , store_step_times_(inp.store_step_times)
+    , telemetry_(std::move(inp.telemetry))
 {
     CELER_EXPECT(inp);
+    CELER_VALIDATE(M == MemSpace::host || suspend_steps_ == 0,
+                   << "suspending tracks is not yet implemented on device: "
+                      "set suspend_steps to zero");
 
     // Create stepper
     CELER_LOG_LOCAL(status) << "Creating states";
@@ -79,9 +85,53 @@ void Transporter<M>::operator()()
 //---------------------------------------------------------------------------//
 /*!
  * Transport the input primaries and all secondaries produced.
+ *
+ * If the tracks are not done after the given number of step iterations, the
+ * remaining tracks are suspended so that the tail of the event doesn't hold
+ * the stream at low occupancy. They can be taken and transported with the
+ * stragglers from other events once all events have been started.
  */
 template<MemSpace M>
 auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
+{
+    CELER_LOG_LOCAL(status)
+        << "Transporting " << primaries.size() << " primaries";
+    return this->transport(
+        [primaries](Stepper<M>& step) { return step(primaries); }, nullptr);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport suspended tracks and all secondaries produced.
+ *
+ * Suspended tracks are resumed whenever track slots are empty, and tracks are
+ * not suspended again.
+ */
+template<MemSpace M>
+auto Transporter<M>::operator()(SuspendedTracks&& tracks) -> TransporterResult
+{
+    CELER_LOG_LOCAL(status)
+        << "Resuming " << tracks.size() << " suspended tracks";
+    SuspendedTracks resumed = std::move(tracks);
+    return this->transport(
+        [&resumed](Stepper<M>& step) {
+            step.resume(&resumed);
+            return step();
+        },
+        &resumed);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport tracks started by the first step to completion.
+ *
+ * If suspended tracks are being resumed, they're added to the state as it
+ * empties.
+ */
+template<MemSpace M>
+template<class F>
+auto Transporter<M>::transport(F&& first_step, SuspendedTracks* resumed)
+    -> TransporterResult
 {
     // Initialize results
     TransporterResult result;
@@ -109,6 +159,18 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
         ++result.num_step_iterations;
         result.num_steps += track_counts.active;
         result.max_queued = std::max(result.max_queued, track_counts.queued);
+        result.max_spilled
+            = std::max(result.max_spilled, track_counts.spilled);
+        result.max_secondaries
+            = std::max(result.max_secondaries, track_counts.secondaries);
+        if (telemetry_)
+        {
+            (*telemetry_)(stepper_->state().stream_id(),
+                          track_counts,
+                          [this](MapStrDouble* times) {
+                              this->accum_action_times(times);
+                          });
+        }
     };
 
     constexpr size_type min_alloc{65536};
@@ -127,21 +189,33 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
 #else
     ScopedSignalHandler interrupted{SIGINT};
 #endif
-    CELER_LOG_LOCAL(status)
-        << "Transporting " << primaries.size() << " primaries";
 
     StepTimer record_step_time{store_step_times_ ? &result.step_times
                                                  : nullptr};
     size_type remaining_steps = max_steps_;
 
     auto& step = *stepper_;
-    // Copy primaries to device and transport the first step
-    auto track_counts = step(primaries);
+    // Add the new tracks and transport the first step
+    auto track_counts = first_step(step);
     append_track_counts(track_counts);
     record_step_time();
 
-    while (track_counts)
+    auto is_resuming = [resumed] { return resumed && !resumed->empty(); };
+    while (track_counts || is_resuming())
     {
+        if (suspend_steps_ > 0 && !resumed
+            && result.num_step_iterations >= suspend_steps_)
+        {
+            // Set the remaining tracks aside to run with other stragglers
+            auto suspended = step.suspend();
+            CELER_LOG_LOCAL(debug)
+                << "Suspended " << suspended.size() << " tracks after "
+                << result.num_step_iterations << " step iterations";
+            result.num_suspended = suspended.size();
+            suspended_.merge(std::move(suspended));
+            track_counts = {};
+            break;
+        }
         if (CELER_UNLIKELY(--remaining_steps == 0))
         {
             CELER_LOG_LOCAL(error) << "Exceeded step count of " << max_steps_
@@ -156,6 +230,10 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
             break;
         }
 
+        if (resumed)
+        {
+            step.resume(resumed);
+        }
         track_counts = step();
         append_track_counts(track_counts);
         record_step_time();
@@ -165,7 +243,8 @@ auto Transporter<M>::operator()(SpanConstPrimary primaries) -> TransporterResult
     result.num_tracks = std::accumulate(counters.data().get(),
                                         counters.data().get() + counters.size(),
                                         size_type(0));
-    result.num_aborted = track_counts.alive + track_counts.queued;
+    result.num_aborted = track_counts.alive + track_counts.queued
+                         + (resumed ? resumed->size() : 0);
     result.num_track_slots = stepper_->state().size();
 
     if (result.num_aborted > 0)
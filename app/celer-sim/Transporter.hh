@@ -18,6 +18,7 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/track/TrackSuspension.hh"
 
 namespace celeritas
 {
@@ -25,6 +26,7 @@ struct Primary;
 template<MemSpace M>
 class Stepper;
 class CoreParams;
+class TelemetryWriter;
 }  // namespace celeritas
 
 namespace celeritas
@@ -43,11 +45,15 @@ struct TransporterInput
 
     // Loop control
     size_type max_steps{};
+    size_type suspend_steps{};  //!< Iterations before setting tracks aside
     bool store_track_counts{};  //!< Store track counts at each step
     bool store_step_times{};  //!< Store time elapsed for each step
 
     StreamId stream_id{0};
 
+    // Optional periodic snapshots shared across streams
+    std::shared_ptr<TelemetryWriter> telemetry;
+
     //! True if all params are assigned
     explicit operator bool() const
     {
@@ -76,7 +82,10 @@ struct TransporterResult
     size_type num_steps{};  //!< Total number of steps
     size_type num_tracks{};  //!< Total number of tracks
     size_type num_aborted{};  //!< Number of unconverged tracks
+    size_type num_suspended{};  //!< Number of tracks set aside for later
     size_type max_queued{};  //!< Maximum track initializer count
+    size_type max_spilled{};  //!< Maximum initializers spilled to host
+    size_type max_secondaries{};  //!< Maximum secondaries from one step
 };
 
 //---------------------------------------------------------------------------//
@@ -110,6 +119,12 @@ class TransporterBase
     //! Transport the input primaries and all secondaries produced
     virtual TransporterResult operator()(SpanConstPrimary primaries) = 0;
 
+    //! Transport suspended tracks and all secondaries produced
+    virtual TransporterResult operator()(SuspendedTracks&& tracks) = 0;
+
+    //! Take the tracks suspended while transporting primaries
+    virtual SuspendedTracks take_suspended() = 0;
+
     //! Accumulate action times into the map
     virtual void accum_action_times(MapStrDouble*) const = 0;
 };
@@ -131,15 +146,31 @@ class Transporter final : public TransporterBase
     // Transport the input primaries and all secondaries produced
     TransporterResult operator()(SpanConstPrimary primaries) final;
 
+    // Transport suspended tracks and all secondaries produced
+    TransporterResult operator()(SuspendedTracks&& tracks) final;
+
+    //! Take the tracks suspended while transporting primaries
+    SuspendedTracks take_suspended() final
+    {
+        return std::exchange(suspended_, {});
+    }
+
     // Accumulate action times into the map
     void accum_action_times(MapStrDouble*) const final;
 
   private:
     std::shared_ptr<Stepper<M>> stepper_;
     size_type max_steps_;
+    size_type suspend_steps_;
+    SuspendedTracks suspended_;
     size_type num_streams_;
     bool store_track_counts_;
     bool store_step_times_;
+    std::shared_ptr<TelemetryWriter> telemetry_;
+
+    // Transport tracks started by the first step to completion
+    template<class F>
+    TransporterResult transport(F&& first_step, SuspendedTracks* resumed);
 };
 
 //---------------------------------------------------------------------------//
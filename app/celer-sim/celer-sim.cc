@@ -136,6 +136,24 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
         }
         log_and_rethrow(std::move(capture_exception));
     }
+    if (size_type num_batches = run_stream.gather_suspended())
+    {
+        // Finish suspended tracks from all events in combined batches
+        result.resumed.resize(num_batches);
+        MultiExceptionHandler capture_exception;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
+#    pragma omp parallel for
+#endif
+        for (size_type batch = 0; batch < num_batches; ++batch)
+        {
+            activate_device_local();
+
+            CELER_TRY_HANDLE(result.resumed[batch] = run_stream.resume(
+                                 StreamId(get_openmp_thread()), batch),
+                             capture_exception);
+        }
+        log_and_rethrow(std::move(capture_exception));
+    }
     result.action_times = run_stream.get_action_times();
     result.total_time = get_transport_time();
     record_mem = {};
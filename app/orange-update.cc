@@ -4,7 +4,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
 //! \file orange-update.cc
-//! \brief Read in and write back an ORANGE JSON file
+//! \brief Read in and write back an ORANGE JSON or binary file
 //---------------------------------------------------------------------------//
 #include <cstdlib>
 #include <fstream>
@@ -18,6 +18,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
+#include "orange/OrangeInputIO.bin.hh"
 #include "orange/OrangeInputIO.json.hh"
 
 namespace celeritas
@@ -30,16 +31,22 @@ namespace
 void print_usage(char const* exec_name)
 {
     std::cerr << "usage: " << exec_name
-              << " {input}.org.json {output}.org.json\n";
+              << " {input}.org.{json,bin} {output}.org.{json,bin}\n";
 }
 
 //---------------------------------------------------------------------------//
-std::string run(std::istream* is)
+OrangeInput run(std::istream* is, bool binary)
 {
     OrangeInput inp;
-    nlohmann::json::parse(*is).get_to(inp);
-
-    return nlohmann::json(inp).dump(/* indent = */ 0);
+    if (binary)
+    {
+        from_binary(*is, inp);
+    }
+    else
+    {
+        nlohmann::json::parse(*is).get_to(inp);
+    }
+    return inp;
 }
 
 //---------------------------------------------------------------------------//
@@ -86,7 +93,7 @@ int main(int argc, char* argv[])
     else
     {
         // Open the specified file
-        infile.open(args[0]);
+        infile.open(args[0], std::ios::binary);
         if (!infile)
         {
             CELER_LOG(critical) << "Failed to open '" << args[0] << "'";
@@ -95,10 +102,11 @@ int main(int argc, char* argv[])
         instream = &infile;
     }
 
-    std::string result;
+    OrangeInput result;
     try
     {
-        result = celeritas::app::run(instream);
+        result = celeritas::app::run(instream,
+                                     is_orange_binary_filename(args[0]));
     }
     catch (RuntimeError const& e)
     {
@@ -113,19 +121,28 @@ int main(int argc, char* argv[])
 
     if (args[1] == "-")
     {
-        std::cout << result;
+        std::cout << nlohmann::json(result).dump(/* indent = */ 0);
     }
     else
     {
         // Open the specified file
-        std::ofstream outfile{args[1]};
+        bool const binary = is_orange_binary_filename(args[1]);
+        std::ofstream outfile{args[1],
+                              binary ? std::ios::binary : std::ios::out};
         if (!outfile)
         {
             CELER_LOG(critical)
                 << "Failed to open '" << args[1] << "' for writing";
             return EXIT_FAILURE;
         }
-        outfile << result;
+        if (binary)
+        {
+            to_binary(outfile, result);
+        }
+        else
+        {
+            outfile << nlohmann::json(result).dump(/* indent = */ 0);
+        }
     }
 
     return EXIT_SUCCESS;
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+# Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Calibrate track slot and capacity options by running celer-sim over a grid.
+
+Each combination of ``num_track_slots``, ``initializer_capacity``, and
+``secondary_stack_factor`` is run on a short sample of events. The fastest
+configuration that transports every track is recommended, with capacities
+resized from the peak usage observed during the calibration runs.
+
+Track slots and initializers are shared by all streams, so the per-stream
+usage depends on the number of streams. The calibration therefore runs with
+the production stream count (``--num-streams``, by default the first value of
+``OMP_NUM_THREADS``), sampling at least one event per stream, and rejects runs
+that use a different number of streams. The recommendation is written as:
+
+- ``PREFIX.inp.json``: the celer-sim input, whose ``num_track_slots`` and
+  ``initializer_capacity`` are totals divided among the production streams,
+- ``PREFIX.options.json``: per-stream values for celer-g4 input files,
+- ``PREFIX.mac``: ``/celer/`` macro commands for accel-based applications,
+- ``PREFIX.report.json``: all explored configurations and their results.
+"""
+import json
+import math
+import subprocess
+from itertools import product
+from os import environ
+from sys import stderr
+
+
+def parse_list(convert):
+    def parse(text):
+        return [convert(v) for v in text.split(",")]
+    return parse
+
+
+def sample_events(inp, num_events):
+    """Limit the number of events when they are generated or sampled."""
+    for key in ["primary_options", "file_sampling_options"]:
+        opts = inp.get(key)
+        if opts and opts.get("num_events"):
+            opts["num_events"] = min(opts["num_events"], num_events)
+            return True
+    return False
+
+
+def default_num_streams():
+    """Get the number of streams celer-sim uses by default."""
+    threads = environ.get("OMP_NUM_THREADS", "").split(",")[0]
+    return int(threads) if threads.strip() else 1
+
+
+def run_one(exe, inp, num_streams):
+    """Run celer-sim and return the runner output, or an error string."""
+    result = subprocess.run([exe, "-"],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE,
+                            env=dict(environ,
+                                     OMP_NUM_THREADS=str(num_streams)))
+    try:
+        out = json.loads(result.stdout.decode())
+    except json.decoder.JSONDecodeError:
+        out = None
+    if result.returncode or out is None:
+        return f"celer-sim failed with error {result.returncode}"
+    runner = out["result"]["runner"]
+    if runner["num_streams"] != num_streams:
+        return (f"celer-sim used {runner['num_streams']} streams instead of "
+                f"{num_streams}")
+    return runner
+
+
+def summarize(inp, runner):
+    """Calculate throughput and peak capacity usage per stream."""
+    num_streams = runner["num_streams"]
+    slots = math.ceil(inp["num_track_slots"] / num_streams)
+    initializers = math.ceil(inp["initializer_capacity"] / num_streams)
+    secondaries = math.ceil(inp["secondary_stack_factor"] * slots)
+    time = runner["time"]["total"]
+    num_steps = sum(runner["num_steps"])
+    max_queued = max(runner["max_queued"], default=0)
+    max_secondaries = max(runner.get("max_secondaries", []), default=0)
+    return {
+        "num_streams": num_streams,
+        "num_aborted": sum(runner["num_aborted"]),
+        "num_steps": num_steps,
+        "time": time,
+        "steps_per_sec": num_steps / time if time > 0 else 0,
+        "steps_per_sec_per_stream":
+            num_steps / time / num_streams if time > 0 else 0,
+        "max_queued": max_queued,
+        "max_spilled": max(runner["max_spilled"], default=0),
+        "max_secondaries": max_secondaries,
+        "initializer_usage": max_queued / initializers,
+        "secondary_usage": max_secondaries / secondaries,
+    }
+
+
+def recommend(base_inp, results, num_streams, safety, tolerance):
+    """Choose the smallest state within tolerance of the best throughput.
+
+    Capacities are calculated per stream and multiplied by the number of
+    streams, which is the same in calibration and production.
+    """
+    good = [r for r in results
+            if "summary" in r and r["summary"]["num_aborted"] == 0]
+    if not good:
+        return None
+    best_rate = max(r["summary"]["steps_per_sec"] for r in good)
+    candidates = [r for r in good
+                  if r["summary"]["steps_per_sec"]
+                  >= (1 - tolerance) * best_rate]
+    chosen = min(candidates,
+                 key=lambda r: (r["options"]["num_track_slots"],
+                                -r["summary"]["steps_per_sec"]))
+
+    # Resize capacities from the peak usage over all completed runs with the
+    # chosen number of track slots
+    slots = chosen["options"]["num_track_slots"]
+    same_slots = [r["summary"] for r in good
+                  if r["options"]["num_track_slots"] == slots]
+    stream_slots = math.ceil(slots / num_streams)
+    max_queued = max(s["max_queued"] for s in same_slots)
+    max_secondaries = max(s["max_secondaries"] for s in same_slots)
+
+    init_cap = max(math.ceil(safety * max_queued), stream_slots)
+    sec_factor = max(safety * max_secondaries / stream_slots, 1.0)
+    # Round the stack factor up to the nearest half
+    sec_factor = math.ceil(2 * sec_factor) / 2
+
+    per_stream = {
+        "num_track_slots": stream_slots,
+        "initializer_capacity": init_cap,
+        "secondary_stack_factor": sec_factor,
+        "auto_flush": stream_slots,
+    }
+    inp = dict(base_inp)
+    inp.update({
+        "num_track_slots": stream_slots * num_streams,
+        "initializer_capacity": init_cap * num_streams,
+        "secondary_stack_factor": sec_factor,
+    })
+    return {
+        "chosen": chosen,
+        "num_streams": num_streams,
+        "per_stream": per_stream,
+        "celer_sim": inp,
+    }
+
+
+def write_macro(f, per_stream):
+    f.write("# Track capacity options from calibrate-track-capacity.py\n")
+    for (cmd, key) in [("maxNumTracks", "num_track_slots"),
+                       ("maxInitializers", "initializer_capacity"),
+                       ("secondaryStackFactor", "secondary_stack_factor"),
+                       ("autoFlush", "auto_flush")]:
+        f.write(f"/celer/{cmd} {per_stream[key]}\n")
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument(
+        "input",
+        help="Base celer-sim JSON input file")
+    parser.add_argument(
+        "-o", "--output",
+        default="calibration",
+        help="Output filename prefix")
+    parser.add_argument(
+        "--exe",
+        default=environ.get("CELERITAS_DEMO_EXE", "celer-sim"),
+        help="Path to celer-sim executable")
+    parser.add_argument(
+        "--num-streams", type=int, default=default_num_streams(),
+        help="Number of streams in production (default: OMP_NUM_THREADS)")
+    parser.add_argument(
+        "--num-events", type=int, default=4,
+        help="Number of events to sample for each configuration (at least "
+             "one per stream)")
+    parser.add_argument(
+        "--num-track-slots", type=parse_list(int),
+        help="Comma-separated total track slots (default: base x 1/4 to 4)")
+    parser.add_argument(
+        "--initializer-capacity", type=parse_list(int),
+        help="Comma-separated initializer capacities (default: base)")
+    parser.add_argument(
+        "--secondary-stack-factor", type=parse_list(float),
+        help="Comma-separated secondary stack factors (default: base)")
+    parser.add_argument(
+        "--safety", type=float, default=1.5,
+        help="Multiplier applied to peak capacity usage")
+    parser.add_argument(
+        "--tolerance", type=float, default=0.05,
+        help="Fractional throughput loss accepted for a smaller state")
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        base_inp = json.load(f)
+
+    sample_inp = dict(base_inp)
+    for key in ["primary_options", "file_sampling_options"]:
+        if key in sample_inp:
+            sample_inp[key] = dict(sample_inp[key])
+    num_events = max(args.num_events, args.num_streams)
+    if not sample_events(sample_inp, num_events):
+        print("warning: all events in the event file will be transported "
+              "for each configuration", file=stderr)
+    # Disable per-step output and outputs with side effects
+    sample_inp.update({
+        "write_track_counts": False,
+        "write_step_times": False,
+        "mctruth_file": "",
+        "slot_diagnostic_prefix": "",
+        "telemetry_file": "",
+        "warm_up": True,
+    })
+
+    slots = args.num_track_slots or [
+        max(1, int(base_inp["num_track_slots"] * f))
+        for f in (0.25, 0.5, 1, 2, 4)]
+    init_caps = (args.initializer_capacity
+                 or [base_inp["initializer_capacity"]])
+    sec_factors = (args.secondary_stack_factor
+                   or [base_inp["secondary_stack_factor"]])
+
+    results = []
+    for (ns, ic, sf) in product(slots, init_caps, sec_factors):
+        options = {
+            "num_track_slots": ns,
+            "initializer_capacity": ic,
+            "secondary_stack_factor": sf,
+        }
+        print("Running", json.dumps(options), file=stderr)
+        inp = dict(sample_inp, **options)
+        runner = run_one(args.exe, inp, args.num_streams)
+        entry = {"options": options}
+        if isinstance(runner, str):
+            print("  ", runner, file=stderr)
+            entry["error"] = runner
+        else:
+            entry["summary"] = summarize(inp, runner)
+            print("   {steps_per_sec:.4g} steps/s, {num_aborted} aborted"
+                  .format(**entry["summary"]), file=stderr)
+        results.append(entry)
+
+    rec = recommend(base_inp, results, args.num_streams, args.safety,
+                    args.tolerance)
+    report = {
+        "input": args.input,
+        "num_events": num_events,
+        "safety": args.safety,
+        "tolerance": args.tolerance,
+        "results": results,
+        "recommended": rec and {k: rec[k] for k in ["chosen", "num_streams",
+                                                    "per_stream"]},
+    }
+    with open(args.output + ".report.json", "w") as f:
+        json.dump(report, f, indent=1)
+    print("Report written to", args.output + ".report.json", file=stderr)
+
+    if rec is None:
+        print("fatal: no configuration completed without aborting tracks",
+              file=stderr)
+        return 1
+
+    with open(args.output + ".inp.json", "w") as f:
+        json.dump(rec["celer_sim"], f, indent=1)
+    with open(args.output + ".options.json", "w") as f:
+        json.dump(rec["per_stream"], f, indent=1)
+    with open(args.output + ".mac", "w") as f:
+        write_macro(f, rec["per_stream"])
+    print(f"Recommended per-stream options for {rec['num_streams']} streams:",
+          json.dumps(rec["per_stream"]), file=stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    exit(main())
@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
+#include <chrono>
 #include <csignal>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <CLHEP/Units/SystemOfUnits.h>
 #include <G4MTRunManager.hh>
 #include <G4ParticleDefinition.hh>
@@ -33,6 +36,8 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/ext/GeantUnits.hh"
 #include "celeritas/global/ActionSequence.hh"
+#include "celeritas/global/StreamPool.hh"
+#include "celeritas/global/TelemetryWriter.hh"
 #include "celeritas/io/EventWriter.hh"
 #include "celeritas/io/RootEventWriter.hh"
 #include "celeritas/phys/PDGNumber.hh"
@@ -42,6 +47,7 @@
 #include "SharedParams.hh"
 
 #include "detail/HitManager.hh"
+#include "detail/HitProcessor.hh"
 #include "detail/OffloadWriter.hh"
 
 namespace celeritas
@@ -55,7 +61,10 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
     : auto_flush_(options.auto_flush ? options.auto_flush
                                      : options.max_num_tracks)
     , max_steps_(options.max_steps)
+    , suspend_steps_(options.suspend_steps)
+    , shared_timeout_(options.shared_timeout)
     , dump_primaries_{params.offload_writer()}
+    , telemetry_{params.telemetry()}
 {
     CELER_VALIDATE(params,
                    << "Celeritas SharedParams was not initialized before "
@@ -98,6 +107,10 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
         }
     }
 
+    CELER_VALIDATE(suspend_steps_ == 0 || !celeritas::device(),
+                   << "suspending tracks is not yet implemented on device: "
+                      "set suspend_steps to zero");
+
     if (CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_GEANT4)
     {
         /*!
@@ -117,6 +130,14 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
         hit_processor_ = hit_manager->make_local_processor(stream_id);
     }
 
+    if (auto const& stream_pool = params.stream_pool())
+    {
+        // Transport on streams shared by all threads
+        stream_pool_ = stream_pool;
+        pool_results_ = std::make_shared<StreamPoolResults>();
+        return;
+    }
+
     // Create stepper
     StepperInput inp;
     inp.params = params.Params();
@@ -148,12 +169,14 @@ void LocalTransporter::InitializeEvent(int id)
 
     event_id_ = UniqueEventId(id);
 
-    if (!(G4Threading::IsMultithreadedApplication()
-          && G4MTRunManager::SeedOncePerCommunication()))
+    if (step_
+        && !(G4Threading::IsMultithreadedApplication()
+             && G4MTRunManager::SeedOncePerCommunication()))
     {
         // Since Geant4 schedules events dynamically, reseed the Celeritas RNGs
         // using the Geant4 event ID for reproducibility. This guarantees that
-        // an event can be reproduced given the event ID.
+        // an event can be reproduced given the event ID. Shared streams are
+        // instead reseeded when they start transporting a submission.
         step_->reseed(event_id_);
     }
 }
@@ -181,14 +204,11 @@ void LocalTransporter::Push(G4Track const& g4track)
     track.position = convert_from_geant(g4track.GetPosition(), clhep_length);
     track.direction = convert_from_geant(g4track.GetMomentumDirection(), 1);
     track.time = convert_from_geant(g4track.GetGlobalTime(), clhep_time);
-
-    if (CELER_UNLIKELY(g4track.GetWeight() != 1.0))
-    {
-        //! \todo Non-unit weights: see issue #1268
-        CELER_LOG(error) << "incoming track (PDG " << pdg.get()
-                         << ", track ID " << g4track.GetTrackID()
-                         << ") has non-unit weight " << g4track.GetWeight();
-    }
+    track.weight = g4track.GetWeight();
+    CELER_VALIDATE(track.weight > 0,
+                   << "incoming track (PDG " << pdg.get() << ", track ID "
+                   << g4track.GetTrackID() << ") has nonpositive weight "
+                   << track.weight);
 
     /*!
      * \todo Eliminate event ID from primary.
@@ -196,35 +216,132 @@ void LocalTransporter::Push(G4Track const& g4track)
     track.event_id = EventId{0};
 
     buffer_.push_back(track);
-    if (buffer_.size() >= auto_flush_)
+    if (buffer_.size() >= auto_flush_ && stream_pool_)
     {
-        /*!
-         * \todo Maybe only run one iteration? But then make sure that Flush
-         * still transports active tracks to completion.
-         */
-        this->Flush();
+        // Transport asynchronously while this thread continues the event
+        this->submit();
+    }
+    else if (buffer_.size() >= auto_flush_)
+    {
+        // Transport, possibly deferring stragglers to the next flush
+        this->transport(/* allow_suspend = */ true);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport the buffered tracks and all secondaries produced.
+ * Transport the buffered and suspended tracks and all secondaries produced.
  */
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
-    if (buffer_.empty())
+    if (stream_pool_)
+    {
+        // Wait for this thread's submissions and process their hits locally
+        this->submit();
+        auto hits = pool_results_->wait();
+        if (hit_processor_)
+        {
+            for (auto const& steps : hits)
+            {
+                (*hit_processor_)(steps);
+            }
+        }
+        return;
+    }
+
+    this->transport(/* allow_suspend = */ false);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear local data.
+ *
+ * This may need to be executed on the same thread it was created in order to
+ * safely deallocate some Geant4 objects under the hood...
+ */
+void LocalTransporter::Finalize()
+{
+    CELER_EXPECT(*this);
+    CELER_VALIDATE(buffer_.empty(),
+                   << "offloaded tracks (" << buffer_.size()
+                   << " in buffer) were not flushed");
+    CELER_VALIDATE(suspended_.empty(),
+                   << "offloaded tracks (" << suspended_.size()
+                   << " suspended) were not flushed");
+    CELER_VALIDATE(!pool_results_ || pool_results_->pending() == 0,
+                   << "offloaded tracks (" << pool_results_->pending()
+                   << " submissions to shared streams) were not flushed");
+
+    // Reset all data
+    CELER_LOG_LOCAL(debug) << "Resetting local transporter";
+    *this = {};
+
+    CELER_ENSURE(!*this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action times.
+ *
+ * Shared streams are not owned by this thread, so no times are returned when
+ * they're in use.
+ */
+auto LocalTransporter::GetActionTime() const -> MapStrReal
+{
+    CELER_EXPECT(*this);
+
+    MapStrReal result;
+    if (!step_)
+    {
+        return result;
+    }
+    auto const& action_seq = step_->actions();
+    if (action_seq.action_times())
+    {
+        // Save kernel timing if synchronization is enabled
+        auto const& action_ptrs = action_seq.actions().step();
+        auto const& time = action_seq.accum_time();
+
+        CELER_ASSERT(action_ptrs.size() == time.size());
+        for (auto i : range(action_ptrs.size()))
+        {
+            result[std::string{action_ptrs[i]->label()}] = time[i];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport buffered and suspended tracks on the local stream.
+ *
+ * Previously suspended tracks are resumed into empty track slots before each
+ * step. If suspension is allowed, any tracks still alive after the configured
+ * number of step iterations are removed from the state and saved to be
+ * resumed by the next call. Otherwise all tracks are transported to
+ * completion.
+ */
+void LocalTransporter::transport(bool allow_suspend)
+{
+    CELER_EXPECT(step_);
+    if (buffer_.empty() && suspended_.empty())
     {
         return;
     }
     if (celeritas::device())
     {
-        CELER_LOG_LOCAL(info)
-            << "Transporting " << buffer_.size() << " tracks from event "
-            << event_id_.unchecked_get() << " with Celeritas";
+        auto msg = CELER_LOG_LOCAL(info);
+        msg << "Transporting " << buffer_.size() << " tracks";
+        if (!suspended_.empty())
+        {
+            msg << " (and " << suspended_.size() << " suspended tracks)";
+        }
+        msg << " from event " << event_id_.unchecked_get()
+            << " with Celeritas";
     }
 
-    if (dump_primaries_)
+    if (dump_primaries_ && !buffer_.empty())
     {
         // Write offload particles if user requested
         (*dump_primaries_)(buffer_);
@@ -239,21 +356,38 @@ void LocalTransporter::Flush()
      */
     ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
 
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
+    // Resume suspended tracks, copy buffered tracks to device, and transport
+    // the first step
+    step_->resume(&suspended_);
+    auto track_counts = buffer_.empty() ? (*step_)()
+                                        : (*step_)(make_span(buffer_));
     buffer_.clear();
+    this->write_telemetry(track_counts);
 
     size_type step_iters = 1;
 
-    while (track_counts)
+    while (track_counts || !suspended_.empty())
     {
         CELER_VALIDATE(step_iters < max_steps_,
                        << "number of step iterations exceeded the allowed "
                           "maximum ("
                        << max_steps_ << ")");
 
+        if (allow_suspend && suspend_steps_ > 0
+            && step_iters >= suspend_steps_)
+        {
+            // Defer the remaining tracks to the next flush
+            suspended_.merge(step_->suspend());
+            CELER_LOG_LOCAL(debug)
+                << "Suspended " << suspended_.size() << " tracks after "
+                << step_iters << " step iterations";
+            break;
+        }
+
+        step_->resume(&suspended_);
         track_counts = (*step_)();
         ++step_iters;
+        this->write_telemetry(track_counts);
 
         CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
     }
@@ -261,48 +395,64 @@ void LocalTransporter::Flush()
 
 //---------------------------------------------------------------------------//
 /*!
- * Clear local data.
- *
- * This may need to be executed on the same thread it was created in order to
- * safely deallocate some Geant4 objects under the hood...
+ * Queue buffered tracks on the shared streams.
  */
-void LocalTransporter::Finalize()
+void LocalTransporter::submit()
 {
-    CELER_EXPECT(*this);
-    CELER_VALIDATE(buffer_.empty(),
-                   << "offloaded tracks (" << buffer_.size()
-                   << " in buffer) were not flushed");
+    CELER_EXPECT(stream_pool_ && pool_results_);
+    if (buffer_.empty())
+    {
+        return;
+    }
+    if (celeritas::device())
+    {
+        CELER_LOG_LOCAL(info)
+            << "Submitting " << buffer_.size() << " tracks from event "
+            << event_id_.unchecked_get() << " to shared Celeritas streams";
+    }
 
-    // Reset all data
-    CELER_LOG_LOCAL(debug) << "Resetting local transporter";
-    *this = {};
+    if (dump_primaries_)
+    {
+        // Write offload particles if user requested
+        (*dump_primaries_)(buffer_);
+    }
 
-    CELER_ENSURE(!*this);
+    std::vector<Primary> primaries;
+    primaries.reserve(buffer_.size());
+    std::swap(primaries, buffer_);
+    auto deadline = StreamPool::Deadline::max();
+    if (shared_timeout_ > 0)
+    {
+        deadline = StreamPool::Clock::now()
+                   + std::chrono::duration_cast<StreamPool::Clock::duration>(
+                       std::chrono::duration<double>(shared_timeout_));
+    }
+    stream_pool_->submit(std::move(primaries),
+                         event_id_,
+                         pool_results_->make_completion(),
+                         deadline);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Get the accumulated action times.
+ * Tally a local step and periodically write a snapshot.
+ *
+ * The snapshot's action times are those reported by \c GetActionTime .
  */
-auto LocalTransporter::GetActionTime() const -> MapStrReal
+void LocalTransporter::write_telemetry(StepperResult const& counts) const
 {
-    CELER_EXPECT(*this);
-
-    MapStrReal result;
-    auto const& action_seq = step_->actions();
-    if (action_seq.action_times())
+    if (!telemetry_)
     {
-        // Save kernel timing if synchronization is enabled
-        auto const& action_ptrs = action_seq.actions().step();
-        auto const& time = action_seq.accum_time();
-
-        CELER_ASSERT(action_ptrs.size() == time.size());
-        for (auto i : range(action_ptrs.size()))
-        {
-            result[std::string{action_ptrs[i]->label()}] = time[i];
-        }
+        return;
     }
-    return result;
+    (*telemetry_)(step_->sp_state()->stream_id(),
+                  counts,
+                  [this](TelemetryWriter::MapStrDouble* times) {
+                      for (auto&& [label, time] : this->GetActionTime())
+                      {
+                          (*times)[label] = time;
+                      }
+                  });
 }
 
 //---------------------------------------------------------------------------//
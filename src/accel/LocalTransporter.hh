@@ -18,6 +18,7 @@
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackSuspension.hh"
 
 class G4Track;
 
@@ -32,6 +33,9 @@ class OffloadWriter;
 
 struct SetupOptions;
 class SharedParams;
+class StreamPool;
+class StreamPoolResults;
+class TelemetryWriter;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -44,6 +48,20 @@ class SharedParams;
  *   of the event)
  * - a tracking action (to try offloading every track)
  *
+ * If \c SetupOptions::num_shared_streams is set, the buffered tracks are
+ * instead submitted to Celeritas streams shared by all worker threads, and
+ * the thread continues with its own work while they are transported. At the
+ * end of the event, \c Flush waits for all of the event's tracks to complete
+ * and then sends their hits to this thread's sensitive detectors.
+ *
+ * If \c SetupOptions::suspend_steps is set, tracks still alive after that
+ * many step iterations of an automatic flush are suspended and resumed
+ * alongside the tracks of the next flush, so that a few long-lived tracks
+ * don't keep the thread from buffering more work. All suspended tracks are
+ * completed by \c Flush at the end of the event. With shared streams, the
+ * suspension is instead done by the stream pool to time-slice between
+ * threads.
+ *
  * \warning Due to Geant4 thread-local allocators, this class \em must be
  * finalized or destroyed on the same CPU thread in which is created and used!
  *
@@ -89,23 +107,46 @@ class LocalTransporter
     size_type GetBufferSize() const { return buffer_.size(); }
 
     //! Whether the class instance is initialized
-    explicit operator bool() const { return static_cast<bool>(step_); }
+    explicit operator bool() const
+    {
+        return static_cast<bool>(step_) || static_cast<bool>(stream_pool_);
+    }
 
   private:
     using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
+    using SPStreamPool = std::shared_ptr<StreamPool>;
 
     std::shared_ptr<ParticleParams const> particles_;
     std::shared_ptr<StepperInterface> step_;
     std::vector<Primary> buffer_;
+    SuspendedTracks suspended_;
     std::shared_ptr<detail::HitProcessor> hit_processor_;
 
+    // Shared across threads to transport offloaded tracks
+    SPStreamPool stream_pool_;
+    std::shared_ptr<StreamPoolResults> pool_results_;
+
     UniqueEventId event_id_;
 
     size_type auto_flush_{};
     size_type max_steps_{};
+    size_type suspend_steps_{};
+    double shared_timeout_{};
 
     // Shared across threads to write flushed particles
     SPOffloadWriter dump_primaries_;
+
+    // Shared across threads to write throughput snapshots
+    std::shared_ptr<TelemetryWriter> telemetry_;
+
+    // Transport buffered and suspended tracks on the local stream
+    void transport(bool allow_suspend);
+
+    // Queue buffered tracks on the shared streams
+    void submit();
+
+    // Tally a local step and periodically write a snapshot
+    void write_telemetry(StepperResult const& counts) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -16,6 +16,7 @@
 #include "corecel/sys/Device.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/track/WeightWindowOptions.hh"
 
 class G4LogicalVolume;
 
@@ -50,6 +51,7 @@ struct SDSetupOptions
         bool position{false};
         bool direction{false};  //!< AKA momentum direction
         bool kinetic_energy{false};
+        bool weight{false};
     };
 
     //! Call back to Geant4 sensitive detectors
@@ -82,6 +84,15 @@ struct SDSetupOptions
  *
  * The interface for the "along-step factory" (input parameters and output) is
  * described in \c AlongStepFactoryInterface .
+ *
+ * Shared streams (\c num_shared_streams) take offloaded batches round-robin
+ * between events. With shared streams, \c suspend_steps is the length of a
+ * time slice: a batch that has run that many step iterations while other
+ * offloads are waiting is suspended and requeued. If \c shared_timeout is
+ * set, an offload that hasn't completed that many seconds after it was
+ * submitted fails, and offloads with earlier deadlines are started first.
+ * Only submissions from the same event are merged into a running stream (see
+ * \c merge_threshold).
  */
 struct SetupOptions
 {
@@ -113,6 +124,10 @@ struct SetupOptions
     std::string physics_output_file;
     //! Filename to dump a HepMC3 copy of offloaded tracks as events
     std::string offload_output_file;
+    //! File or "unix:" socket path for periodic throughput snapshots
+    std::string telemetry_file;
+    //! Seconds between throughput snapshots of each stream
+    double telemetry_interval{60};
     //!@}
 
     //!@{
@@ -129,6 +144,18 @@ struct SetupOptions
     real_type secondary_stack_factor{3.0};
     //! Number of tracks to buffer before offloading (if unset: max num tracks)
     size_type auto_flush{};
+    //! Step iterations before deferring an auto-flush's stragglers (host only)
+    size_type suspend_steps{};
+    //!@}
+
+    //!@{
+    //! \name Shared stream options
+    //! Number of streams shared by all Geant4 threads (if unset: one each)
+    size_type num_shared_streams{};
+    //! Merge the event's queued offloads below this fraction of active slots
+    real_type merge_threshold{0.5};
+    //! Seconds after submission before a shared offload fails (if set)
+    real_type shared_timeout{};
     //!@}
 
     //!@{
@@ -159,6 +186,8 @@ struct SetupOptions
     //! \name Physics options
     //! Ignore the following EM process names
     VecString ignore_processes;
+    //! Roulette and split offloaded tracks (if threshold is set)
+    WeightWindowOptions weight_window;
     //!@}
 
     //!@{
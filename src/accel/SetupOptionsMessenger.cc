@@ -175,6 +175,12 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->offload_output_file,
             "offloadOutputFile",
             "Filename for copy of offloaded tracks as events");
+    add_cmd(&options->telemetry_file,
+            "telemetryFile",
+            "File or unix: socket for periodic throughput snapshots");
+    add_cmd(&options->telemetry_interval,
+            "telemetryInterval",
+            "Seconds between throughput snapshots");
     add_cmd(&options->max_num_tracks,
             "maxNumTracks",
             "Number of track \"slots\" to be transported simultaneously");
@@ -193,9 +199,21 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->auto_flush,
             "autoFlush",
             "Number of tracks to buffer before offloading");
+    add_cmd(&options->suspend_steps,
+            "suspendSteps",
+            "Step iterations before deferring stragglers to the next flush");
     add_cmd(&options->max_field_substeps,
             "maxFieldSubsteps",
             "Limit on substeps in the field propagator");
+    add_cmd(&options->num_shared_streams,
+            "numSharedStreams",
+            "Number of streams shared by all worker threads");
+    add_cmd(&options->merge_threshold,
+            "mergeThreshold",
+            "Fraction of active tracks to merge an event's offloads");
+    add_cmd(&options->shared_timeout,
+            "sharedTimeout",
+            "Seconds after submission before a shared offload fails");
 
     directories_.emplace_back(new CelerDirectory(
         "/celer/detector/", "Celeritas sensitive detector setup options"));
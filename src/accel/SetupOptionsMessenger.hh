@@ -34,7 +34,10 @@ struct SetupOptions;
   maxInitializers      | Maximum number of track initializers
   secondaryStackFactor | At least the average number of secondaries per track
   autoFlush            | Number of tracks to buffer before offloading
+  suspendSteps         | Step iterations before deferring stragglers
   maxFieldSubsteps     | Limit on substeps in field propagator
+  numSharedStreams     | Number of streams shared by all worker threads
+  mergeThreshold       | Fraction of active tracks to merge offloads
 
  * The following option is exposed in the \c /celer/detector/ command
  * "directory":
@@ -16,6 +16,7 @@
 #include <CLHEP/Random/Random.h>
 #include <G4Electron.hh>
 #include <G4Gamma.hh>
+#include <G4MTRunManager.hh>
 #include <G4ParticleDefinition.hh>
 #include <G4ParticleTable.hh>
 #include <G4Positron.hh>
@@ -45,6 +46,8 @@
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/StreamPool.hh"
+#include "celeritas/global/TelemetryWriter.hh"
 #include "celeritas/io/EventWriter.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/RootEventWriter.hh"
@@ -57,6 +60,7 @@
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/WeightWindowAction.hh"
 #include "celeritas/user/SlotDiagnostic.hh"
 #include "celeritas/user/StepCollector.hh"
 
@@ -556,6 +560,11 @@ void SharedParams::initialize_core(SetupOptions const& options)
         // multithreading.
         params.max_streams = this->num_streams();
     }
+    if (options.num_shared_streams > params.max_streams)
+    {
+        // Shared streams are numbered independently of Geant4 threads
+        params.max_streams = options.num_shared_streams;
+    }
 
     // Allocate device streams, or use the default stream if there is only one.
     if (celeritas::device() && !options.default_stream
@@ -581,11 +590,27 @@ void SharedParams::initialize_core(SetupOptions const& options)
         return along_step;
     }());
 
+    // Add weight window before the step collector so recorded post-step
+    // weights include its adjustment
+    if (options.weight_window)
+    {
+        params.action_reg->insert(
+            std::make_shared<WeightWindowAction>(params.action_reg->next_id(),
+                                                 *params.particle,
+                                                 *params.geometry,
+                                                 options.weight_window));
+    }
+
     // Construct sensitive detector callback
     if (options.sd)
     {
         hit_manager_ = std::make_shared<detail::HitManager>(
             *params.geometry, *params.particle, options.sd, params.max_streams);
+        if (options.num_shared_streams > 0)
+        {
+            // Return hits to the Geant4 thread that offloaded the tracks
+            hit_manager_->defer_steps(options.num_shared_streams);
+        }
         step_collector_ = std::make_shared<StepCollector>(
             StepCollector::VecInterface{hit_manager_},
             params.geometry,
@@ -604,6 +629,40 @@ void SharedParams::initialize_core(SetupOptions const& options)
                                         options.slot_diagnostic_prefix);
     }
 
+    // Write periodic throughput snapshots from every stream
+    if (!options.telemetry_file.empty())
+    {
+        telemetry_ = std::make_shared<TelemetryWriter>(
+            options.telemetry_file,
+            options.telemetry_interval,
+            params_->max_streams());
+        output_reg_->insert(telemetry_);
+    }
+
+    // Launch streams shared by all Geant4 threads
+    if (options.num_shared_streams > 0)
+    {
+        StreamPoolInput inp;
+        inp.params = params_;
+        if (hit_manager_)
+        {
+            inp.take_hits = [hm = hit_manager_](StreamId sid) {
+                return hm->take_deferred(sid);
+            };
+        }
+        inp.num_streams = options.num_shared_streams;
+        inp.num_track_slots = options.max_num_tracks;
+        inp.max_steps = options.max_steps;
+        inp.slice_steps = options.suspend_steps;
+        inp.max_merged = options.max_num_events;
+        inp.merge_threshold = options.merge_threshold;
+        inp.reseed = !(G4Threading::IsMultithreadedApplication()
+                       && G4MTRunManager::SeedOncePerCommunication());
+        inp.action_times = options.action_times;
+        inp.telemetry = telemetry_;
+        stream_pool_ = std::make_shared<StreamPool>(std::move(inp));
+    }
+
     // Translate supported particles
     particles_ = build_g4_particles(params_->particle(), params_->physics());
 
@@ -29,6 +29,8 @@ class CoreStateInterface;
 struct Primary;
 struct SetupOptions;
 class StepCollector;
+class StreamPool;
+class TelemetryWriter;
 class GeantGeoParams;
 class OutputRegistry;
 
@@ -110,17 +112,25 @@ class SharedParams
     //! \name Internal use only
 
     using SPHitManager = std::shared_ptr<detail::HitManager>;
+    using SPStreamPool = std::shared_ptr<StreamPool>;
     using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     using SPState = std::shared_ptr<CoreStateInterface>;
+    using SPTelemetryWriter = std::shared_ptr<TelemetryWriter>;
     using SPConstGeantGeoParams = std::shared_ptr<GeantGeoParams const>;
 
     // Hit manager, to be used only by LocalTransporter
     inline SPHitManager const& hit_manager() const;
 
+    // Optional shared streams, only for use by LocalTransporter
+    inline SPStreamPool const& stream_pool() const;
+
     // Optional offload writer, only for use by LocalTransporter
     inline SPOffloadWriter const& offload_writer() const;
 
+    // Optional throughput snapshots, only for use by LocalTransporter
+    inline SPTelemetryWriter const& telemetry() const;
+
     // Output registry
     inline SPOutputRegistry const& output_reg() const;
 
@@ -141,9 +151,11 @@ class SharedParams
     std::shared_ptr<CoreParams> params_;
     std::shared_ptr<detail::HitManager> hit_manager_;
     std::shared_ptr<StepCollector> step_collector_;
+    SPStreamPool stream_pool_;
     VecG4ParticleDef particles_;
     std::string output_filename_;
     SPOffloadWriter offload_writer_;
+    SPTelemetryWriter telemetry_;
     std::vector<std::shared_ptr<CoreStateInterface>> states_;
 
     // Lazily created
@@ -199,6 +211,18 @@ auto SharedParams::hit_manager() const -> SPHitManager const&
     return hit_manager_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Optional shared streams, only for use by LocalTransporter.
+ *
+ * If streams are not shared between Geant4 threads, this will be null.
+ */
+auto SharedParams::stream_pool() const -> SPStreamPool const&
+{
+    CELER_EXPECT(*this);
+    return stream_pool_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Optional offload writer, only for use by LocalTransporter.
@@ -209,6 +233,16 @@ auto SharedParams::offload_writer() const -> SPOffloadWriter const&
     return offload_writer_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Optional throughput snapshot writer, only for use by LocalTransporter.
+ */
+auto SharedParams::telemetry() const -> SPTelemetryWriter const&
+{
+    CELER_EXPECT(*this);
+    return telemetry_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Output registry for writing data at end of run.
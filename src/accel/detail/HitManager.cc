@@ -44,6 +44,7 @@ void update_selection(StepPointSelection* selection,
     selection->pos = options.position;
     selection->dir = options.direction;
     selection->energy = options.kinetic_energy;
+    selection->weight = options.weight;
 }
 
 //---------------------------------------------------------------------------//
@@ -118,6 +119,35 @@ auto HitManager::make_local_processor(StreamId sid) -> SPProcessor
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Buffer steps from shared streams instead of processing them.
+ *
+ * This must be called before the step collector is constructed, since the
+ * event ID is added to the selected step data. Each of the given streams
+ * stores the steps it gathers until they are taken by \c take_deferred .
+ */
+void HitManager::defer_steps(StreamId::size_type num_streams)
+{
+    CELER_EXPECT(num_streams > 0);
+    CELER_EXPECT(!this->deferred());
+
+    selection_.event_id = true;
+    deferred_.resize(num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take the steps buffered by a shared stream.
+ *
+ * This must be called from the thread that is transporting the stream.
+ */
+auto HitManager::take_deferred(StreamId sid) -> VecStepOutput
+{
+    CELER_EXPECT(sid < deferred_.size());
+    return std::exchange(deferred_[sid.get()], {});
+}
+
 //---------------------------------------------------------------------------//
 //! Default destructor
 HitManager::~HitManager() = default;
@@ -146,6 +176,11 @@ auto HitManager::filters() const -> Filters
  */
 void HitManager::process_steps(HostStepState state)
 {
+    if (this->deferred())
+    {
+        this->defer(state.steps, state.stream_id);
+        return;
+    }
     auto& process_hits = this->get_local_hit_processor(state.stream_id);
     process_hits(state.steps);
 }
@@ -156,6 +191,11 @@ void HitManager::process_steps(HostStepState state)
  */
 void HitManager::process_steps(DeviceStepState state)
 {
+    if (this->deferred())
+    {
+        this->defer(state.steps, state.stream_id);
+        return;
+    }
     auto& process_hits = this->get_local_hit_processor(state.stream_id);
     process_hits(state.steps);
 }
@@ -269,6 +309,24 @@ HitProcessor& HitManager::get_local_hit_processor(StreamId sid)
     return *processors_[sid.unchecked_get()];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy steps to the stream's buffer.
+ */
+template<MemSpace M>
+void HitManager::defer(StepStateData<Ownership::reference, M> const& steps,
+                       StreamId sid)
+{
+    CELER_EXPECT(sid < deferred_.size());
+
+    DetectorStepOutput output;
+    copy_steps(&output, steps);
+    if (output)
+    {
+        deferred_[sid.get()].push_back(std::move(output));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -12,6 +12,7 @@
 
 #include "geocel/Types.hh"
 #include "celeritas/geo/GeoFwd.hh"
+#include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepInterface.hh"
 
 class G4LogicalVolume;
@@ -39,6 +40,10 @@ class HitProcessor;
  * - Maps those volumes to VecGeom geometry
  * - Creates a HitProcessor for each Geant4 thread
  *
+ * When Celeritas streams are shared between Geant4 threads, the steps are
+ * instead buffered per stream with their event IDs by \c defer_steps so that
+ * the owning Geant4 thread can process them later.
+ *
  * \warning Because of low-level problems with Geant4 allocators, the hit
  * processors must be allocated and deallocated on the same thread in which
  * they're used.
@@ -55,6 +60,7 @@ class HitManager final : public StepInterface
     using SPProcessor = std::shared_ptr<HitProcessor>;
     using VecVolId = std::vector<VolumeId>;
     using VecParticle = std::vector<G4ParticleDefinition const*>;
+    using VecStepOutput = std::vector<DetectorStepOutput>;
     //!@}
 
   public:
@@ -67,6 +73,12 @@ class HitManager final : public StepInterface
     // Create local hit processor
     SPProcessor make_local_processor(StreamId sid);
 
+    // Buffer steps from shared streams instead of processing them
+    void defer_steps(StreamId::size_type num_streams);
+
+    // Take the steps buffered by a shared stream
+    VecStepOutput take_deferred(StreamId sid);
+
     // Default destructor
     ~HitManager();
 
@@ -93,6 +105,9 @@ class HitManager final : public StepInterface
     //! Access mapped particles if recreating G4Tracks later
     VecParticle const& geant_particles() const { return particles_; }
 
+    //! Whether steps are buffered rather than processed
+    bool deferred() const { return !deferred_.empty(); }
+
   private:
     using VecLV = std::vector<G4LogicalVolume const*>;
 
@@ -107,6 +122,7 @@ class HitManager final : public StepInterface
 
     std::vector<std::weak_ptr<HitProcessor>> processor_weakptrs_;
     std::vector<HitProcessor*> processors_;
+    std::vector<VecStepOutput> deferred_;
 
     // Construct vecgeom/geant volumes
     void setup_volumes(GeoParams const& geo, SDSetupOptions const& setup);
@@ -115,6 +131,11 @@ class HitManager final : public StepInterface
 
     // Ensure thread-local hit processor exists and return it
     HitProcessor& get_local_hit_processor(StreamId);
+
+    // Copy steps to the stream's buffer
+    template<MemSpace M>
+    void defer(StepStateData<Ownership::reference, M> const& steps,
+               StreamId sid);
 };
 
 //---------------------------------------------------------------------------//
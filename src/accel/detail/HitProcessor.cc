@@ -217,11 +217,14 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
                    out.points[sp].energy,
                    CLHEP::MeV);
             HP_SET(points[sp]->SetMomentumDirection, out.points[sp].dir, 1);
-            /*!
-             * \todo Celeritas currently ignores incoming particle weight and
-             * does not perform any variance reduction. See issue #1268.
-             */
-            points[sp]->SetWeight(1.0);
+            if (!out.points[sp].weight.empty())
+            {
+                points[sp]->SetWeight(out.points[sp].weight[i]);
+            }
+            else
+            {
+                points[sp]->SetWeight(1.0);
+            }
         }
 #undef HP_SET
 
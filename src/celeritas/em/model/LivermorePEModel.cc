@@ -93,6 +93,10 @@ auto LivermorePEModel::applicability() const -> SetApplicability
 //---------------------------------------------------------------------------//
 /*!
  * Get the microscopic cross sections for the given particle and material.
+ *
+ * Elemental cross sections are calculated exactly at each interaction rather
+ * than tabulated for element selection: a log-spaced table would smear the
+ * K and L absorption edges across a bin and bias the selected element there.
  */
 auto LivermorePEModel::micro_xs(Applicability) const -> MicroXsBuilders
 {
@@ -77,26 +77,30 @@ UrbanMscParams::UrbanMscParams(ParticleParams const& particles,
     static Array<double, 2> const a_coeff{{0.87, 0.70}};
     static Array<double, 2> const b_coeff{{2.0 / 3, 1.0 / 2}};
 
-    // Builders
-    auto mdata = make_builder(&host_data.material_data);
-    auto pmdata = make_builder(&host_data.par_mat_data);
-    mdata.reserve(materials.num_materials());
-    pmdata.reserve(2 * materials.num_materials());
-
-    for (auto mat_id : range(MaterialId{materials.num_materials()}))
+    // Build material- and particle-dependent data independently for each
+    // material, in parallel if OpenMP is enabled
+    size_type const num_materials = materials.num_materials();
+    Array<ParticleId, 2> const par_ids{
+        {particles.find(pdg::electron()), particles.find(pdg::positron())}};
+    std::vector<UrbanMscMaterialData> mat_data(num_materials);
+    std::vector<UrbanMscParMatData> par_mat_data(par_ids.size()
+                                                 * num_materials);
+
+#if defined(_OPENMP)
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < num_materials; ++i)
     {
-        auto&& mat = materials.get(mat_id);
+        auto&& mat = materials.get(MaterialId{i});
 
         // Build material-dependent data
-        mdata.push_back(UrbanMscParams::calc_material_data(mat));
+        mat_data[i] = UrbanMscParams::calc_material_data(mat);
 
         // Build particle-dependent data
-        Array<ParticleId, 2> const par_ids{{particles.find(pdg::electron()),
-                                            particles.find(pdg::positron())}};
         double const zeff = mat.zeff();
         for (size_type p : range(par_ids.size()))
         {
-            UrbanMscParMatData this_pm;
+            UrbanMscParMatData& this_pm = par_mat_data[i * par_ids.size() + p];
 
             // Calculate scaled zeff
             this_pm.scaled_zeff = a_coeff[p] * fastpow(zeff, b_coeff[p]);
@@ -117,13 +121,19 @@ UrbanMscParams::UrbanMscParams(ParticleParams const& particles,
                 this_pm.d_over_r = 1.15 - 9.76e-4 * zeff;
                 CELER_ASSERT(0 < this_pm.d_over_r);
             }
-            pmdata.push_back(this_pm);
-            CELER_ASSERT(
-                host_data.at<UrbanMscParMatData>(mat_id, par_ids[p]).get() + 1
-                == host_data.par_mat_data.size());
         }
     }
 
+    make_builder(&host_data.material_data)
+        .insert_back(mat_data.begin(), mat_data.end());
+    make_builder(&host_data.par_mat_data)
+        .insert_back(par_mat_data.begin(), par_mat_data.end());
+    CELER_ASSERT(host_data.par_mat_data.size()
+                 == host_data.at<UrbanMscParMatData>(
+                            MaterialId{num_materials - 1}, par_ids.back())
+                            .get()
+                        + 1);
+
     // Get the cross section energy grid limits (this checks that the limits
     // are the same for all particles/materials)
     auto energy_limit = helper.energy_grid_bounds();
@@ -133,16 +133,20 @@ void WentzelOKVIParams::build_data(HostVal<WentzelOKVIData>& host_data,
     // Build material data
     if (host_data.params.is_combined)
     {
+        // Materials are independent, so compute them in parallel
         std::vector<real_type> inv_mass_cbrt_sq(materials.num_materials(), 0);
-        for (auto mat_id : range(MaterialId(materials.num_materials())))
+#if defined(_OPENMP)
+#    pragma omp parallel for
+#endif
+        for (size_type i = 0; i < inv_mass_cbrt_sq.size(); ++i)
         {
-            auto mat = materials.get(mat_id);
+            auto mat = materials.get(MaterialId{i});
             for (auto elcomp_id : range(ElementComponentId(mat.num_elements())))
             {
                 auto const& el_comp = mat.elements()[elcomp_id.get()];
                 auto atomic_mass
                     = mat.make_element_view(elcomp_id).atomic_mass();
-                inv_mass_cbrt_sq[mat_id.get()]
+                inv_mass_cbrt_sq[i]
                     += el_comp.fraction
                        / std::pow(atomic_mass.value(), real_type(2) / 3);
             }
@@ -13,6 +13,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -53,6 +54,8 @@
 #include <G4Transportation.hh>
 #include <G4TransportationManager.hh>
 #include <G4Types.hh>
+#include <G4UserLimits.hh>
+#include <G4UserSpecialCuts.hh>
 #include <G4VEnergyLossProcess.hh>
 #include <G4VMultipleScattering.hh>
 #include <G4VPhysicalVolume.hh>
@@ -317,6 +320,31 @@ to_form_factor_type(G4NuclearFormfactorType const& form_factor_type)
     CELER_ASSERT_UNREACHABLE();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a particle has the process that applies region user limits.
+ *
+ * Geant4 ignores the minimum kinetic energy of \c G4UserLimits unless the
+ * \c G4UserSpecialCuts process is attached to the particle.
+ */
+bool has_user_special_cuts(G4ParticleDefinition const& particle)
+{
+    auto const* pm = particle.GetProcessManager();
+    if (!pm)
+    {
+        return false;
+    }
+    auto const& pl = *pm->GetProcessList();
+    for (auto i : range(pl.size()))
+    {
+        if (dynamic_cast<G4UserSpecialCuts const*>(pl[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a populated \c ImportParticle vector.
@@ -352,6 +380,7 @@ import_particles(GeantImporter::DataSelection::Flags particle_flags)
         particle.spin = g4_particle_def.GetPDGSpin();
         particle.lifetime = g4_particle_def.GetPDGLifeTime();
         particle.is_stable = g4_particle_def.GetPDGStable();
+        particle.user_special_cuts = has_user_special_cuts(g4_particle_def);
 
         if (!particle.is_stable)
         {
@@ -755,6 +784,22 @@ import_phys_materials(GeantImporter::DataSelection::Flags particle_flags,
     return materials;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access the minimum kinetic energy stored in a user limits base class.
+ *
+ * \c G4UserLimits::GetUserMinEkine takes a track, which derived classes may
+ * use to calculate a track-dependent limit. Reading the protected member
+ * through a member pointer avoids constructing a fake track.
+ */
+struct UserLimitsAccessor : G4UserLimits
+{
+    static G4double min_ekine(G4UserLimits const& limits)
+    {
+        return limits.*(&UserLimitsAccessor::fMinEkine);
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a populated \c ImportRegion vector.
@@ -778,6 +823,25 @@ std::vector<ImportRegion> import_regions()
         region.field_manager = (g4reg->GetFieldManager() != nullptr);
         region.production_cuts = (g4reg->GetProductionCuts() != nullptr);
         region.user_limits = (g4reg->GetUserLimits() != nullptr);
+        if (auto* limits = g4reg->GetUserLimits())
+        {
+            if (typeid(*limits) == typeid(G4UserLimits))
+            {
+                // Minimum kinetic energy is independent of the track for
+                // the base user limits class
+                region.min_energy = UserLimitsAccessor::min_ekine(*limits)
+                                    / CLHEP::MeV;
+            }
+            else
+            {
+                static TypeDemangler<G4UserLimits> const demangle_limits;
+                CELER_LOG(warning)
+                    << "Ignoring minimum kinetic energy of user limits '"
+                    << demangle_limits(*limits) << "' in region '"
+                    << region.name
+                    << "': derived limits may depend on the track";
+            }
+        }
 
         // Add region to result
         result[i] = std::move(region);
@@ -41,6 +41,13 @@ struct ImportData;
  * the corresponding volume name is empty (corresponding perhaps to a "parallel
  * world" or otherwise unused volume) or is enclosed with braces (used for
  * virtual volumes such as `[EXTERIOR]` or temporary boolean/reflected volumes.
+ *
+ * The material IDs are deliberately not stored in the geometry's volume
+ * records (ORANGE \c VolumeRecord or VecGeom logical volume user data): the
+ * geometry is constructed before the materials and doesn't depend on them,
+ * and the lookup is a single gather from a small array that stays in cache.
+ * The \c TestEm3Flat.DISABLED_crossing_performance test compares the cost of
+ * boundary crossings with and without the material lookup.
  */
 class GeoMaterialParams final
     : public ParamsDataInterface<GeoMaterialParamsData>
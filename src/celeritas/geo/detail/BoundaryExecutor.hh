@@ -12,6 +12,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/mat/MaterialTrackView.hh"
+#include "celeritas/phys/detail/TrackingCutExecutor.hh"
 #include "celeritas/track/SimTrackView.hh"
 
 #include "../GeoMaterialView.hh"
@@ -31,6 +32,9 @@ namespace detail
  *
  * \pre The track must have already been physically moved to the correct point
  * on the boundary.
+ *
+ * If the new material has a tracking cut above the particle's energy, the
+ * track is killed immediately.
  */
 struct BoundaryExecutor
 {
@@ -74,6 +78,19 @@ BoundaryExecutor::operator()(celeritas::CoreTrackView& track)
         auto mat = track.make_material_view();
         mat = {matid};
 
+        auto cutoffs = track.make_cutoff_view();
+        if (cutoffs.has_tracking_cuts())
+        {
+            auto particle = track.make_particle_view();
+            if (particle.energy() < cutoffs.tracking(particle.particle_id()))
+            {
+                // Kill the track since it's below the tracking cut of the
+                // new region
+                TrackingCutExecutor{}(track);
+                return;
+            }
+        }
+
         CELER_ENSURE(geo.is_on_boundary());
     }
     else
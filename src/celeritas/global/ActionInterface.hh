@@ -72,6 +72,25 @@ is_action_sorted(StepActionOrder aorder, TrackOrder torder)
                    || aorder == StepActionOrder::along));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether only active tracks are in the leading threads at the given order.
+ *
+ * When tracks are partitioned by status at the start of the step, the threads
+ * \c [0, num_active) map to every track that was active after
+ * initialization, and the mapping is unchanged until the next step. Actions
+ * at the end of the step must still visit the inactive slots to locate
+ * vacancies for secondaries.
+ */
+inline constexpr bool
+is_status_sorted(StepActionOrder aorder, TrackOrder torder)
+{
+    // CAUTION: check that this matches \c SortTracksAction::SortTracksAction
+    return torder == TrackOrder::reindex_status
+           && aorder > StepActionOrder::sort_start
+           && aorder < StepActionOrder::end;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether track sorting (reindexing) is enabled.
@@ -23,6 +23,8 @@
 #include "CoreParams.hh"
 #include "CoreState.hh"
 
+#include "detail/ActionLaunchUtils.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -122,19 +124,9 @@ void ActionLauncher<F>::operator()(StepActionT const& action,
                                    CoreState<MemSpace::device> const& state,
                                    F const& call_thread) const
 {
-    if (state.has_action_range()
-        && is_action_sorted(action.order(), params.init()->track_order()))
-    {
-        // Launch on a subset of threads
-        return (*this)(state.get_action_range(action.action_id()),
-                       state.stream_id(),
-                       call_thread);
-    }
-    else
-    {
-        // Not partitioned by action: launch on all threads
-        return (*this)(state, call_thread);
-    }
+    return (*this)(detail::get_action_threads(action, params, state),
+                   state.stream_id(),
+                   call_thread);
 }
 
 //---------------------------------------------------------------------------//
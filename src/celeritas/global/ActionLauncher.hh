@@ -13,40 +13,40 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "ActionInterface.hh"
 #include "CoreParams.hh"
 #include "CoreState.hh"
 #include "KernelContextException.hh"
 
+#include "detail/ActionLaunchUtils.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Helper function to run an executor in parallel on CPU.
- *
- * Example:
- * \code
- void FooHelper::step(CoreParams const& params,
-                         CoreStateHost& state) const
- {
-    launch_core(params, state, "foo-helper", make_blah_executor(blah));
- }
- * \endcode
+ * Helper function to run an executor in parallel on CPU over a thread range.
  */
 template<class F>
 void launch_core(std::string_view label,
                  celeritas::CoreParams const& params,
                  celeritas::CoreState<MemSpace::host>& state,
+                 Range<ThreadId> threads,
                  F&& execute_thread)
 {
+    CELER_EXPECT(threads.empty() || *threads.end() <= state.size());
+
     MultiExceptionHandler capture_exception;
+    size_type const begin = threads.begin()->get();
+    size_type const end = threads.end()->get();
 #if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
 #    pragma omp parallel for
 #endif
-    for (size_type i = 0, size = state.size(); i != size; ++i)
+    for (size_type i = begin; i < end; ++i)
     {
         CELER_TRY_HANDLE_CONTEXT(
             execute_thread(ThreadId{i}),
@@ -59,7 +59,38 @@ void launch_core(std::string_view label,
 
 //---------------------------------------------------------------------------//
 /*!
- * Helper function to run an action in parallel on CPU over all states.
+ * Helper function to run an executor in parallel on CPU.
+ *
+ * Example:
+ * \code
+ void FooHelper::step(CoreParams const& params,
+                         CoreStateHost& state) const
+ {
+    launch_core(params, state, "foo-helper", make_blah_executor(blah));
+ }
+ * \endcode
+ */
+template<class F>
+void launch_core(std::string_view label,
+                 celeritas::CoreParams const& params,
+                 celeritas::CoreState<MemSpace::host>& state,
+                 F&& execute_thread)
+{
+    return launch_core(label,
+                       params,
+                       state,
+                       range(ThreadId{state.size()}),
+                       std::forward<F>(execute_thread));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function to run an action in parallel on CPU.
+ *
+ * If tracks are sorted by this action, only the threads in the action's
+ * partition are executed; if they are partitioned by status, only the active
+ * tracks at the front are executed. These arguments should be consistent with
+ * those in \c ActionLauncher.device.hh .
  *
  * Example:
  * \code
@@ -76,8 +107,11 @@ void launch_action(CoreStepActionInterface const& action,
                    celeritas::CoreState<MemSpace::host>& state,
                    F&& execute_thread)
 {
-    return launch_core(
-        action.label(), params, state, std::forward<F>(execute_thread));
+    return launch_core(action.label(),
+                       params,
+                       state,
+                       detail::get_action_threads(action, params, state),
+                       std::forward<F>(execute_thread));
 }
 
 //---------------------------------------------------------------------------//
@@ -133,6 +133,7 @@ void CoreState<M>::reset()
 {
     counters_ = CoreStateCounters{};
     counters_.num_vacancies = this->size();
+    spilled_.clear();
 
     // Reset all the track slots to inactive
     fill(TrackStatus::inactive, &this->ref().sim.status);
@@ -129,6 +129,12 @@ class CoreState final : public CoreStateInterface
     //! Track initialization counters
     CoreStateCounters const& counters() const final { return counters_; }
 
+    //! Track initializers that overflowed the queue, stored on host
+    std::vector<TrackInitializer>& spilled_initializers()
+    {
+        return spilled_;
+    }
+
     //// USER DATA ////
 
     //! Access auxiliary state data
@@ -171,6 +177,9 @@ class CoreState final : public CoreStateInterface
     // Counters for track initialization and activity
     CoreStateCounters counters_;
 
+    // Oldest track initializers moved out of the full queue
+    std::vector<TrackInitializer> spilled_;
+
     // User-added data associated with params
     AuxStateVec aux_state_;
 
@@ -132,7 +132,9 @@ auto Stepper<M>::operator()() -> result_type
     result.generated = counters.num_generated;
     result.active = counters.num_active;
     result.alive = counters.num_alive;
-    result.queued = counters.num_initializers;
+    result.queued = counters.num_initializers + counters.num_spilled;
+    result.spilled = counters.num_spilled;
+    result.secondaries = counters.num_secondaries;
 
     return result;
 }
@@ -177,6 +179,38 @@ void Stepper<M>::reseed(UniqueEventId event_id)
     reseed_rng(get_ref<M>(*params_->rng()), state_->ref().rng, event_id);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Remove all tracks from the state so they can be resumed later.
+ *
+ * Both the tracks in flight and the pending track initializers are removed,
+ * and the state is reset.
+ */
+template<MemSpace M>
+SuspendedTracks Stepper<M>::suspend()
+{
+    ScopedProfiling profile_this{"suspend"};
+    return suspend_tracks(*params_, *state_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resume suspended tracks in empty track slots.
+ *
+ * Tracks are resumed only if there are empty slots; the rest are left in the
+ * suspended list. This should be called before a step so that the resumed
+ * tracks are transported along with any tracks already in the state.
+ *
+ * \return Number of tracks resumed
+ */
+template<MemSpace M>
+size_type Stepper<M>::resume(SuspendedTracks* suspended)
+{
+    CELER_EXPECT(suspended);
+    ScopedProfiling profile_this{"resume"};
+    return resume_tracks(*params_, *state_, suspended);
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
@@ -18,6 +18,7 @@
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/random/RngParamsFwd.hh"
 #include "celeritas/track/TrackInitData.hh"
+#include "celeritas/track/TrackSuspension.hh"
 
 #include "CoreState.hh"
 #include "CoreTrackData.hh"
@@ -62,8 +63,10 @@ struct StepperResult
 {
     size_type generated{};  //!< New primaries added
     size_type queued{};  //!< Pending track initializers at end of step
+    size_type spilled{};  //!< Pending initializers stored on host
     size_type active{};  //!< Active tracks at start of step
     size_type alive{};  //!< Active and alive at end of step
+    size_type secondaries{};  //!< Secondaries produced during the step
 
     //! True if more steps need to be run
     explicit operator bool() const { return queued > 0 || alive > 0; }
@@ -107,6 +110,12 @@ class StepperInterface
     // Reseed the RNGs at the start of an event for reproducibility
     virtual void reseed(UniqueEventId event_id) = 0;
 
+    // Remove all tracks from the state so they can be resumed later
+    virtual SuspendedTracks suspend() = 0;
+
+    // Resume suspended tracks in empty track slots
+    virtual size_type resume(SuspendedTracks* suspended) = 0;
+
     //! Get action sequence for timing diagnostics
     virtual ActionSequenceT const& actions() const = 0;
 
@@ -139,6 +148,19 @@ class StepperInterface
        alive_tracks = step();
    }
    \endcode
+ *
+ * Tracks that take too long to complete can be suspended to free the state
+ * for other work, and resumed later (possibly by a different stepper) once
+ * there are enough of them to fill the track slots:
+ * \code
+   SuspendedTracks stragglers = step.suspend();
+   // ... transport other events, merging their stragglers
+   do
+   {
+       step.resume(&stragglers);
+       alive_tracks = step();
+   } while (alive_tracks || !stragglers.empty());
+   \endcode
  */
 template<MemSpace M>
 class Stepper final : public StepperInterface
@@ -168,6 +190,12 @@ class Stepper final : public StepperInterface
     // Reseed the RNGs at the start of an event for reproducibility
     void reseed(UniqueEventId event_id) final;
 
+    // Remove all tracks from the state so they can be resumed later
+    SuspendedTracks suspend() final;
+
+    // Resume suspended tracks in empty track slots
+    size_type resume(SuspendedTracks* suspended) final;
+
     //! Get action sequence for timing diagnostics
     ActionSequenceT const& actions() const final { return *actions_; }
 
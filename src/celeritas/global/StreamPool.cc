@@ -0,0 +1,539 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StreamPool.cc
+//---------------------------------------------------------------------------//
+#include "StreamPool.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Device.hh"
+#include "celeritas/track/TrackInitParams.hh"
+
+#include "ActionSequence.hh"
+#include "CoreParams.hh"
+#include "Stepper.hh"
+#include "TelemetryWriter.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and launch a thread for each stream.
+ */
+StreamPool::StreamPool(StreamPoolInput&& inp) : input_{std::move(inp)}
+{
+    CELER_VALIDATE(input_,
+                   << "invalid shared stream options: check the number of "
+                      "streams, track slots, and merge threshold");
+    CELER_VALIDATE(input_.num_streams <= input_.params->max_streams(),
+                   << "number of shared streams (" << input_.num_streams
+                   << ") exceeds the maximum number of streams ("
+                   << input_.params->max_streams() << ")");
+    CELER_VALIDATE(
+        input_.max_merged <= input_.params->init()->max_events(),
+        << "number of merged submissions (" << input_.max_merged
+        << ") exceeds the maximum number of events ("
+        << input_.params->init()->max_events() << ")");
+    CELER_VALIDATE(input_.slice_steps == 0 || !celeritas::device(),
+                   << "time slicing shared streams is not yet supported on "
+                      "device");
+
+    if (celeritas::device())
+    {
+        this->launch<MemSpace::device>();
+    }
+    else
+    {
+        this->launch<MemSpace::host>();
+    }
+
+    CELER_LOG(info) << "Launched " << this->num_streams()
+                    << " shared Celeritas streams";
+    CELER_ENSURE(this->num_streams() == input_.num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish queued submissions and join the threads.
+ */
+StreamPool::~StreamPool()
+{
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        stop_ = true;
+    }
+    queued_.notify_all();
+    for (auto& t : threads_)
+    {
+        t.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue tracks for transport.
+ *
+ * The completion callback is called from a stream thread after all tracks
+ * from the submission (and any submissions from the same event merged with
+ * it) are done. If the submission is still running after the optional
+ * deadline, it fails with an error.
+ */
+void StreamPool::submit(VecPrimary&& primaries,
+                        UniqueEventId event,
+                        Completion complete,
+                        Deadline deadline)
+{
+    CELER_EXPECT(!primaries.empty());
+    CELER_EXPECT(complete);
+
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        CELER_VALIDATE(!stop_,
+                       << "cannot submit tracks after the shared streams "
+                          "have been stopped");
+        Batch batch;
+        batch.submissions.push_back(
+            {std::move(primaries), std::move(complete), {}});
+        batch.event = event;
+        batch.deadline = deadline;
+        queue_.push_back(std::move(batch));
+    }
+    queued_.notify_one();
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE MEMBER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the steppers and launch their threads.
+ *
+ * All steppers are allocated before any thread is launched so that an
+ * allocation failure is reported to the caller.
+ */
+template<MemSpace M>
+void StreamPool::launch()
+{
+    std::vector<std::shared_ptr<Stepper<M>>> steppers;
+    for (auto sid : range(StreamId{input_.num_streams}))
+    {
+        StepperInput inp;
+        inp.params = input_.params;
+        inp.stream_id = sid;
+        inp.num_track_slots = input_.num_track_slots;
+        inp.action_times = input_.action_times;
+        steppers.push_back(std::make_shared<Stepper<M>>(std::move(inp)));
+    }
+
+    threads_.reserve(steppers.size());
+    for (auto& step : steppers)
+    {
+        threads_.emplace_back(
+            [this, step = std::move(step)] { this->run(*step); });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport batches on a stream until stopped.
+ *
+ * A batch whose time slice ends is put back in the queue. An error while
+ * transporting a batch is reported to all of its submissions, which all
+ * belong to the same event, and the stream is reset so that it can continue
+ * with the next batch.
+ */
+template<MemSpace M>
+void StreamPool::run(Stepper<M>& step)
+{
+    if (M == MemSpace::device)
+    {
+        activate_device_local();
+    }
+    StreamId const sid = step.state().stream_id();
+
+    Batch batch;
+    while (this->pop(&batch))
+    {
+        std::exception_ptr error;
+        try
+        {
+            if (!this->transport(step, &batch))
+            {
+                this->requeue(std::move(batch));
+                batch = {};
+                continue;
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+            CELER_LOG(error) << "Shared stream " << sid.get()
+                             << " failed while transporting "
+                             << batch.submissions.size() << " submission(s)";
+            step.reset_state();
+            if (input_.take_hits)
+            {
+                // Discard steps buffered before the failure
+                input_.take_hits(sid);
+            }
+        }
+
+        for (auto& s : batch.submissions)
+        {
+            s.complete(error ? VecHits{} : std::move(s.hits), error);
+        }
+        this->release(batch.event);
+        batch = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport a batch until it completes or its time slice ends.
+ *
+ * Only fresh submissions from the same event are merged into the batch. Each
+ * submission in the batch is transported as a separate Celeritas event,
+ * numbered by its position in the batch. When the time slice ends and other
+ * batches are waiting, the tracks are suspended into the batch.
+ *
+ * \return Whether the batch is complete
+ */
+template<MemSpace M>
+bool StreamPool::transport(Stepper<M>& step, Batch* batch)
+{
+    CELER_EXPECT(batch && !batch->submissions.empty());
+
+    StreamId const sid = step.state().stream_id();
+    auto const merge_below = static_cast<size_type>(
+        input_.merge_threshold * input_.num_track_slots);
+
+    // Insert the primaries of the last submission in the batch and step
+    auto step_primaries = [&] {
+        auto& primaries = batch->submissions.back().primaries;
+        EventId const event{batch->submissions.size() - 1};
+        for (Primary& p : primaries)
+        {
+            p.event_id = event;
+        }
+        auto result = step(make_span(primaries));
+        VecPrimary{}.swap(primaries);
+        return result;
+    };
+
+    // Tally the step and periodically write a snapshot
+    auto write_telemetry = [&](StepperResult const& counts) {
+        if (!input_.telemetry)
+        {
+            return;
+        }
+        (*input_.telemetry)(
+            sid, counts, [&step](TelemetryWriter::MapStrDouble* times) {
+                auto const& action_seq = step.actions();
+                if (!action_seq.action_times())
+                {
+                    return;
+                }
+                auto const& action_ptrs = action_seq.actions().step();
+                auto const& time = action_seq.accum_time();
+                for (auto i : range(action_ptrs.size()))
+                {
+                    (*times)[std::string{action_ptrs[i]->label()}] = time[i];
+                }
+            });
+    };
+
+    // Fail if the earliest deadline in the batch has passed
+    auto check_deadline = [batch] {
+        CELER_VALIDATE(Clock::now() < batch->deadline,
+                       << "shared stream submission deadline was exceeded");
+    };
+
+    // Whether to end the time slice after a number of step iterations
+    auto end_slice = [this](size_type slice_iters) {
+        return input_.slice_steps > 0 && slice_iters >= input_.slice_steps
+               && this->has_waiting();
+    };
+
+    check_deadline();
+    StepperResult track_counts;
+    if (batch->fresh())
+    {
+        if (input_.reseed && batch->event)
+        {
+            step.reseed(batch->event);
+        }
+        track_counts = step_primaries();
+    }
+    else
+    {
+        // Continue a batch that was suspended
+        step.resume(&batch->suspended);
+        track_counts = step();
+    }
+    ++batch->num_step_iters;
+    size_type slice_iters = 1;
+    write_telemetry(track_counts);
+    this->distribute_hits(sid, batch);
+
+    while (track_counts || !batch->suspended.empty())
+    {
+        CELER_VALIDATE(batch->num_step_iters < input_.max_steps,
+                       << "number of step iterations exceeded the allowed "
+                          "maximum ("
+                       << input_.max_steps << ")");
+        check_deadline();
+
+        if (end_slice(slice_iters))
+        {
+            // Set the tracks aside and let another batch use the stream
+            batch->suspended.merge(step.suspend());
+            return false;
+        }
+
+        if (!batch->suspended.empty())
+        {
+            // Fill empty slots with tracks left over from the last slice
+            step.resume(&batch->suspended);
+            track_counts = step();
+        }
+        else if (batch->submissions.size() < input_.max_merged
+                 && track_counts.queued == 0
+                 && track_counts.alive < merge_below
+                 && this->pop_event(batch))
+        {
+            // Fill the tail of the batch with another submission
+            track_counts = step_primaries();
+        }
+        else
+        {
+            track_counts = step();
+        }
+        ++batch->num_step_iters;
+        ++slice_iters;
+        write_telemetry(track_counts);
+        this->distribute_hits(sid, batch);
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for and take the next batch.
+ *
+ * The batch with the earliest deadline is taken first. Ties are broken in
+ * favor of the event that was least recently given a stream, and then by
+ * queue order. This returns false only if the pool is stopping and the queue
+ * is empty.
+ */
+bool StreamPool::pop(Batch* result)
+{
+    CELER_EXPECT(result);
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    queued_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (queue_.empty())
+    {
+        return false;
+    }
+
+    auto last_served = [this](UniqueEventId event) -> size_type {
+        auto iter = last_served_.find(event);
+        return iter != last_served_.end() ? iter->second : 0;
+    };
+    auto best = queue_.begin();
+    for (auto iter = std::next(best); iter != queue_.end(); ++iter)
+    {
+        if (iter->deadline != best->deadline)
+        {
+            if (iter->deadline < best->deadline)
+            {
+                best = iter;
+            }
+        }
+        else if (last_served(iter->event) < last_served(best->event))
+        {
+            best = iter;
+        }
+    }
+
+    *result = std::move(*best);
+    queue_.erase(best);
+    last_served_[result->event] = ++num_served_;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take the next fresh submission from an event without waiting.
+ *
+ * The submission is appended to the batch, which adopts its deadline if it
+ * is earlier. Submissions without a valid event ID are never merged.
+ */
+bool StreamPool::pop_event(Batch* batch)
+{
+    CELER_EXPECT(batch);
+    if (!batch->event)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    auto iter = std::find_if(
+        queue_.begin(), queue_.end(), [batch](Batch const& other) {
+            return other.event == batch->event && other.fresh();
+        });
+    if (iter == queue_.end())
+    {
+        return false;
+    }
+    CELER_ASSERT(iter->submissions.size() == 1);
+    batch->submissions.push_back(std::move(iter->submissions.front()));
+    batch->deadline = std::min(batch->deadline, iter->deadline);
+    queue_.erase(iter);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Put a suspended batch back in the queue.
+ */
+void StreamPool::requeue(Batch&& batch)
+{
+    CELER_EXPECT(!batch.fresh());
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        queue_.push_back(std::move(batch));
+    }
+    queued_.notify_one();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Forget the scheduling history of an event with no queued batches.
+ */
+void StreamPool::release(UniqueEventId event)
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    bool queued = std::any_of(
+        queue_.begin(), queue_.end(), [event](Batch const& other) {
+            return other.event == event;
+        });
+    if (!queued)
+    {
+        last_served_.erase(event);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether other batches are waiting for a stream.
+ */
+bool StreamPool::has_waiting()
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    return !queue_.empty();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move buffered hits from the stream to their submissions.
+ */
+void StreamPool::distribute_hits(StreamId sid, Batch* batch) const
+{
+    CELER_EXPECT(batch && !batch->submissions.empty());
+    if (!input_.take_hits)
+    {
+        return;
+    }
+
+    auto& submissions = batch->submissions;
+    auto steps = input_.take_hits(sid);
+    if (submissions.size() == 1)
+    {
+        // All steps belong to the only submission
+        auto& hits = submissions.front().hits;
+        hits.insert(hits.end(),
+                    std::make_move_iterator(steps.begin()),
+                    std::make_move_iterator(steps.end()));
+        return;
+    }
+
+    for (auto const& output : steps)
+    {
+        for (auto i : range(submissions.size()))
+        {
+            DetectorStepOutput selected;
+            select_steps(&selected, output, EventId(i));
+            if (selected)
+            {
+                submissions[i].hits.push_back(std::move(selected));
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a callback for a new submission.
+ *
+ * This instance must outlive the returned callback.
+ */
+StreamPool::Completion StreamPoolResults::make_completion()
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    ++pending_;
+    return [this](VecHits&& hits, std::exception_ptr error) {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        hits_.insert(hits_.end(),
+                     std::make_move_iterator(hits.begin()),
+                     std::make_move_iterator(hits.end()));
+        if (error && !error_)
+        {
+            error_ = std::move(error);
+        }
+        CELER_ASSERT(pending_ > 0);
+        --pending_;
+        // Notify while locked so the waiting thread can't destroy this first
+        completed_.notify_all();
+    };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all submissions and take their hits.
+ *
+ * The first error from any submission is rethrown.
+ */
+auto StreamPoolResults::wait() -> VecHits
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    completed_.wait(lock, [this] { return pending_ == 0; });
+
+    if (auto error = std::exchange(error_, nullptr))
+    {
+        hits_.clear();
+        std::rethrow_exception(error);
+    }
+    return std::exchange(hits_, {});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of submissions that have not completed.
+ */
+size_type StreamPoolResults::pending() const
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    return pending_;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
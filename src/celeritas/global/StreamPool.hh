@@ -0,0 +1,241 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StreamPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackSuspension.hh"
+#include "celeritas/user/DetectorSteps.hh"
+
+namespace celeritas
+{
+class CoreParams;
+template<MemSpace M>
+class Stepper;
+class TelemetryWriter;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construction options for a pool of shared streams.
+ *
+ * The optional \c take_hits function is called on a stream's thread after
+ * every step iteration to take the detector steps buffered by that stream,
+ * labeled with the batch-local event IDs.
+ *
+ * If \c slice_steps is nonzero, a batch that has run for that many step
+ * iterations is suspended and requeued whenever other work is waiting. Time
+ * slicing is only supported on host.
+ */
+struct StreamPoolInput
+{
+    using VecHits = std::vector<DetectorStepOutput>;
+    using TakeHits = std::function<VecHits(StreamId)>;
+
+    std::shared_ptr<CoreParams const> params;
+    TakeHits take_hits;  //!< Optional
+
+    size_type num_streams{};  //!< Number of shared streams
+    size_type num_track_slots{};  //!< Track slots per stream
+    size_type max_steps{};  //!< Step iterations before aborting a batch
+    size_type slice_steps{};  //!< Step iterations per time slice (if set)
+    size_type max_merged{1};  //!< Max submissions transported together
+    real_type merge_threshold{};  //!< Fraction of active slots to merge below
+    bool reseed{true};  //!< Reseed the RNG with the submission's event ID
+    bool action_times{false};
+    std::shared_ptr<TelemetryWriter> telemetry;  //!< Optional
+
+    //! True if all required options are set
+    explicit operator bool() const
+    {
+        return params && num_streams > 0 && num_track_slots > 0
+               && max_steps > 0 && max_merged > 0 && merge_threshold >= 0
+               && merge_threshold <= 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport submitted tracks on streams shared by many client threads.
+ *
+ * Each stream is owned by a background thread that takes buffered tracks
+ * submitted by any client (e.g., a Geant4 worker) and transports them to
+ * completion. A client that submits a large shower is therefore free to
+ * continue with other work while idle streams pick up work from other
+ * clients.
+ *
+ * When the number of active tracks in a stream drops below a fraction of its
+ * track slots and no initializers are pending, the tail of the batch is
+ * filled by merging queued submissions \em from the same event into the
+ * stream. Each submission in a batch is assigned a distinct Celeritas event
+ * ID so that its detector steps can be separated from the others and returned
+ * to its client. Merged submissions share the RNG stream of the first
+ * submission in the batch, so only unmerged submissions are reproducible by
+ * event ID.
+ *
+ * Waiting batches are started in order of their earliest submission
+ * deadline, then round-robin between events (the event that was least
+ * recently given a stream goes first), then in submission order. With time
+ * slicing enabled, a batch that has used its slice while other batches are
+ * waiting is suspended and requeued: its tracks and their RNG states are set
+ * aside (see \c suspend_tracks) and resumed later, possibly on another
+ * stream. Sliced batches are therefore not reproducible by event ID either.
+ * A batch that is still running when the earliest deadline of its
+ * submissions has passed is aborted with an error.
+ *
+ * Once the stream drains, each submission's completion callback is called
+ * on the stream's thread with the detector steps from its tracks, or with
+ * the exception that aborted the batch. Because submissions from different
+ * events are never merged, an error is only reported to submissions from the
+ * event being transported. The callback must be thread safe and must not
+ * process the hits itself, since (for example) Geant4 sensitive detectors are
+ * thread local.
+ */
+class StreamPool
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecPrimary = std::vector<Primary>;
+    using VecHits = StreamPoolInput::VecHits;
+    using Completion = std::function<void(VecHits&&, std::exception_ptr)>;
+    using Clock = std::chrono::steady_clock;
+    using Deadline = Clock::time_point;
+    //!@}
+
+  public:
+    // Construct and launch a thread for each stream
+    explicit StreamPool(StreamPoolInput&& inp);
+
+    // Finish queued submissions and join the threads
+    ~StreamPool();
+
+    //! Prevent copying and moving due to shared state in stream threads
+    CELER_DELETE_COPY_MOVE(StreamPool);
+
+    // Queue tracks for transport (thread safe)
+    void submit(VecPrimary&& primaries,
+                UniqueEventId event,
+                Completion complete,
+                Deadline deadline = Deadline::max());
+
+    //! Number of shared streams
+    size_type num_streams() const { return threads_.size(); }
+
+  private:
+    struct Submission
+    {
+        VecPrimary primaries;
+        Completion complete;
+        VecHits hits;
+    };
+
+    //! Submissions transported together on a stream
+    struct Batch
+    {
+        std::vector<Submission> submissions;
+        UniqueEventId event;
+        Deadline deadline{Deadline::max()};
+        SuspendedTracks suspended;  //!< Tracks set aside between slices
+        size_type num_step_iters{0};  //!< Total over all slices
+
+        //! Whether the batch has not been started
+        bool fresh() const { return num_step_iters == 0; }
+    };
+
+    StreamPoolInput input_;
+
+    std::mutex mutex_;
+    std::condition_variable queued_;
+    std::deque<Batch> queue_;
+    std::map<UniqueEventId, size_type> last_served_;
+    size_type num_served_{0};
+    bool stop_{false};
+    std::vector<std::thread> threads_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Construct the steppers and launch their threads
+    template<MemSpace M>
+    void launch();
+
+    // Transport batches on a stream until stopped
+    template<MemSpace M>
+    void run(Stepper<M>& step);
+
+    // Transport a batch until it completes or its time slice ends
+    template<MemSpace M>
+    bool transport(Stepper<M>& step, Batch* batch);
+
+    // Wait for and take the next batch
+    bool pop(Batch* result);
+
+    // Take the next fresh submission from an event without waiting
+    bool pop_event(Batch* batch);
+
+    // Put a suspended batch back in the queue
+    void requeue(Batch&& batch);
+
+    // Forget the scheduling history of an event with no queued batches
+    void release(UniqueEventId event);
+
+    // Whether other batches are waiting for a stream
+    bool has_waiting();
+
+    // Move buffered hits from the stream to their submissions
+    void distribute_hits(StreamId sid, Batch* batch) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collect the results of submissions on a single client thread.
+ *
+ * Completion callbacks created by this class may be called from any stream
+ * thread. The owning thread calls \c wait to block until all outstanding
+ * submissions are complete and to take their detector steps.
+ */
+class StreamPoolResults
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecHits = StreamPool::VecHits;
+    //!@}
+
+  public:
+    // Create a callback for a new submission
+    StreamPool::Completion make_completion();
+
+    // Wait for all submissions and take their hits
+    VecHits wait();
+
+    // Number of submissions that have not completed
+    size_type pending() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::condition_variable completed_;
+    size_type pending_{0};
+    VecHits hits_;
+    std::exception_ptr error_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
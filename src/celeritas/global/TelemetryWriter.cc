@@ -0,0 +1,233 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TelemetryWriter.cc
+//---------------------------------------------------------------------------//
+#include "TelemetryWriter.hh"
+
+#include <cstring>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/StringUtils.hh"
+
+#ifndef _WIN32
+#    include <sys/socket.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+constexpr char unix_prefix[] = "unix:";
+
+#ifndef _WIN32
+// Linux suppresses SIGPIPE per call; macOS and BSD use a socket option
+#    ifdef MSG_NOSIGNAL
+constexpr int send_flags = MSG_NOSIGNAL;
+#    else
+constexpr int send_flags = 0;
+#    endif
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Connect to a Unix domain socket, returning the file descriptor.
+ */
+int connect_socket(std::string const& path)
+{
+#ifndef _WIN32
+    sockaddr_un addr{};
+    CELER_VALIDATE(path.size() < sizeof(addr.sun_path),
+                   << "telemetry socket path '" << path << "' is too long");
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    CELER_VALIDATE(fd >= 0, << "failed to create telemetry socket");
+#    ifdef SO_NOSIGPIPE
+    int enable = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#    endif
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+    {
+        ::close(fd);
+        CELER_VALIDATE(false,
+                       << "failed to connect to telemetry socket at '"
+                       << path << "'");
+    }
+    return fd;
+#else
+    CELER_DISCARD(path);
+    CELER_NOT_IMPLEMENTED("Unix domain sockets on Windows");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Send a complete buffer to a socket.
+ *
+ * A closed peer is reported as a failure rather than raising \c SIGPIPE.
+ */
+bool send_all(int fd, std::string const& buffer)
+{
+#ifndef _WIN32
+    char const* data = buffer.data();
+    std::size_t remaining = buffer.size();
+    while (remaining > 0)
+    {
+        auto sent = ::send(fd, data, remaining, send_flags);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        remaining -= static_cast<std::size_t>(sent);
+    }
+    return true;
+#else
+    CELER_DISCARD(fd);
+    CELER_DISCARD(buffer);
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open the destination.
+ */
+TelemetryWriter::TelemetryWriter(std::string destination,
+                                 double interval,
+                                 size_type num_streams)
+    : destination_{std::move(destination)}
+    , interval_{interval}
+    , streams_(num_streams)
+{
+    CELER_VALIDATE(interval_ > 0,
+                   << "nonpositive telemetry interval " << interval_);
+    CELER_VALIDATE(!destination_.empty(),
+                   << "empty telemetry destination");
+    CELER_EXPECT(num_streams > 0);
+
+    if (starts_with(destination_, unix_prefix))
+    {
+        socket_ = connect_socket(
+            destination_.substr(std::strlen(unix_prefix)));
+    }
+    else
+    {
+        file_.open(destination_, std::ios::out | std::ios::app);
+        CELER_VALIDATE(file_,
+                       << "failed to open telemetry file at '"
+                       << destination_ << "'");
+    }
+    CELER_LOG(info) << "Writing telemetry every " << interval_ << " s to "
+                    << destination_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close the destination.
+ */
+TelemetryWriter::~TelemetryWriter()
+{
+#ifndef _WIN32
+    if (socket_ >= 0)
+    {
+        ::close(socket_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write configuration and snapshot count.
+ */
+void TelemetryWriter::output(JsonPimpl* j) const
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    j->obj = {
+        {"destination", destination_},
+        {"interval", interval_},
+        {"num_snapshots", num_snapshots_},
+        {"failed", failed_},
+    };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a snapshot and reset the stream's per-interval tallies.
+ */
+void TelemetryWriter::write(StreamId stream,
+                            StepperResult const& counts,
+                            MapStrDouble const& action_times,
+                            double time)
+{
+    StreamTally& tally = streams_[stream.get()];
+
+    double steps_per_sec = (tally.num_steps - tally.prev_num_steps)
+                           / (time - tally.prev_time);
+    nlohmann::json snapshot = {
+        {"time", time},
+        {"stream", stream.get()},
+        {"num_step_iterations", tally.num_step_iterations},
+        {"num_steps", tally.num_steps},
+        {"steps_per_sec", steps_per_sec},
+        {"active", counts.active},
+        {"queued", counts.queued},
+        {"alive", counts.alive},
+        {"max_queued", tally.max_queued},
+        {"max_spilled", tally.max_spilled},
+        {"max_secondaries", tally.max_secondaries},
+    };
+    if (!action_times.empty())
+    {
+        snapshot["action_times"] = action_times;
+    }
+
+    tally.prev_num_steps = tally.num_steps;
+    tally.prev_time = time;
+    tally.max_queued = 0;
+    tally.max_spilled = 0;
+    tally.max_secondaries = 0;
+
+    std::string line = snapshot.dump();
+    line.push_back('\n');
+
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    if (failed_)
+    {
+        return;
+    }
+    bool success = false;
+    if (socket_ >= 0)
+    {
+        success = send_all(socket_, line);
+    }
+    else
+    {
+        file_ << line << std::flush;
+        success = static_cast<bool>(file_);
+    }
+    if (!success)
+    {
+        CELER_LOG(warning) << "Failed to write telemetry to " << destination_
+                           << ": further snapshots will be dropped";
+        failed_ = true;
+        return;
+    }
+    ++num_snapshots_;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TelemetryWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/Types.hh"
+#include "Stepper.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Periodically append per-stream throughput snapshots as JSON lines.
+ *
+ * Each stream tallies its step counts on every step iteration; once the
+ * interval has elapsed since that stream's previous snapshot, a single JSON
+ * object is appended to the destination. A snapshot contains:
+ * - \c time: wall time in seconds since the writer was constructed
+ * - \c stream: stream ID
+ * - \c num_step_iterations, \c num_steps: cumulative counts for the stream
+ * - \c steps_per_sec: track steps per second since the previous snapshot
+ * - \c active, \c queued, \c alive: track counts from the latest step
+ * - \c max_queued, \c max_spilled, \c max_secondaries: high-water marks of
+ *   the initializer queue, host spill buffer, and secondaries produced in a
+ *   single step since the previous snapshot
+ * - \c action_times: cumulative time per action (only when action timing is
+ *   enabled)
+ *
+ * The destination is a file path, opened in append mode, or a Unix domain
+ * socket path prefixed with \c unix: . Snapshots from different streams are
+ * serialized by a mutex, but the per-step tally only touches stream-local
+ * data. If writing fails (including when the socket's reader disconnects), a
+ * warning is emitted and further snapshots are dropped rather than
+ * interrupting the run.
+ *
+ * The writer also reports its configuration and snapshot count through the
+ * output registry.
+ */
+class TelemetryWriter final : public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using MapStrDouble = std::unordered_map<std::string, double>;
+    //!@}
+
+  public:
+    // Open the destination
+    TelemetryWriter(std::string destination,
+                    double interval,
+                    size_type num_streams);
+
+    // Close the destination
+    ~TelemetryWriter();
+
+    //! Prevent copying and moving due to the open destination
+    CELER_DELETE_COPY_MOVE(TelemetryWriter);
+
+    // Tally a step and write a snapshot if the interval has elapsed
+    template<class F>
+    inline void operator()(StreamId stream,
+                           StepperResult const& counts,
+                           F&& accum_action_times);
+
+    //! Category of data to write
+    Category category() const final { return Category::internal; }
+
+    //! Name of the entry inside the category.
+    std::string_view label() const final { return "telemetry"; }
+
+    // Write configuration and snapshot count
+    void output(JsonPimpl*) const final;
+
+  private:
+    struct alignas(64) StreamTally
+    {
+        size_type num_step_iterations{};
+        size_type num_steps{};
+        size_type max_queued{};
+        size_type max_spilled{};
+        size_type max_secondaries{};
+        size_type prev_num_steps{};
+        double prev_time{};
+    };
+
+    std::string destination_;
+    double interval_;
+    Stopwatch get_time_;
+    std::vector<StreamTally> streams_;
+
+    mutable std::mutex mutex_;
+    std::ofstream file_;
+    int socket_{-1};
+    size_type num_snapshots_{0};
+    bool failed_{false};
+
+    // Write and reset the stream's tallies
+    void write(StreamId stream,
+               StepperResult const& counts,
+               MapStrDouble const& action_times,
+               double time);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Tally a step and write a snapshot if the interval has elapsed.
+ *
+ * The action time accumulator is only called when a snapshot is written.
+ */
+template<class F>
+void TelemetryWriter::operator()(StreamId stream,
+                                 StepperResult const& counts,
+                                 F&& accum_action_times)
+{
+    CELER_EXPECT(stream < streams_.size());
+
+    StreamTally& tally = streams_[stream.get()];
+    ++tally.num_step_iterations;
+    tally.num_steps += counts.active;
+    tally.max_queued = std::max(tally.max_queued, counts.queued);
+    tally.max_spilled = std::max(tally.max_spilled, counts.spilled);
+    tally.max_secondaries
+        = std::max(tally.max_secondaries, counts.secondaries);
+
+    double time = get_time_();
+    if (time - tally.prev_time >= interval_)
+    {
+        MapStrDouble action_times;
+        accum_action_times(&action_times);
+        this->write(stream, counts, action_times, time);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
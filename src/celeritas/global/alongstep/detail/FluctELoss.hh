@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/math/Algorithms.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/distribution/EnergyLossHelper.hh"
 #include "celeritas/em/distribution/EnergyLossTraits.hh"
@@ -108,7 +109,12 @@ CELER_FUNCTION auto FluctELoss::calc_eloss(CoreTrackView const& track,
     auto particle = track.make_particle_view();
     auto phys = track.make_physics_view();
 
-    if (apply_cut && particle.energy() < phys.scalars().lowest_electron_energy)
+    // Region-dependent tracking cut can exceed the global lowest energy
+    Energy const lowest_energy = celeritas::max(
+        phys.scalars().lowest_electron_energy,
+        track.make_cutoff_view().tracking(particle.particle_id()));
+
+    if (apply_cut && particle.energy() < lowest_energy)
     {
         // Deposit all energy immediately when we start below the tracking cut
         return particle.energy();
@@ -164,7 +170,7 @@ CELER_FUNCTION auto FluctELoss::calc_eloss(CoreTrackView const& track,
     }
 
     if (apply_cut
-        && (particle.energy() - eloss <= phys.scalars().lowest_electron_energy))
+        && (particle.energy() - eloss <= lowest_energy))
     {
         // Deposit all energy when we end below the tracking cut
         return particle.energy();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "corecel/Assert.hh"
+#include "corecel/math/Algorithms.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/phys/PhysicsStepUtils.hh"
 
@@ -71,7 +72,12 @@ CELER_FUNCTION auto MeanELoss::calc_eloss(CoreTrackView const& track,
     auto particle = track.make_particle_view();
     auto phys = track.make_physics_view();
 
-    if (apply_cut && particle.energy() < phys.scalars().lowest_electron_energy)
+    // Region-dependent tracking cut can exceed the global lowest energy
+    Energy const lowest_energy = celeritas::max(
+        phys.scalars().lowest_electron_energy,
+        track.make_cutoff_view().tracking(particle.particle_id()));
+
+    if (apply_cut && particle.energy() < lowest_energy)
     {
         // Deposit all energy when we start below the tracking cut
         return particle.energy();
@@ -81,7 +87,7 @@ CELER_FUNCTION auto MeanELoss::calc_eloss(CoreTrackView const& track,
     Energy eloss = calc_mean_energy_loss(particle, phys, step);
 
     if (apply_cut
-        && (particle.energy() - eloss <= phys.scalars().lowest_electron_energy))
+        && (particle.energy() - eloss <= lowest_energy))
     {
         // Deposit all energy when we end below the tracking cut
         return particle.energy();
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionLaunchUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/track/TrackInitParams.hh"
+
+#include "../ActionInterface.hh"
+#include "../CoreParams.hh"
+#include "../CoreState.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the range of threads that an action must be launched over.
+ *
+ * - If tracks are sorted by this action, only the action's partition is
+ *   launched.
+ * - If tracks are partitioned by status, only the leading active tracks are
+ *   launched.
+ * - Otherwise, all track slots are launched.
+ */
+template<MemSpace M>
+Range<ThreadId> get_action_threads(CoreStepActionInterface const& action,
+                                   CoreParams const& params,
+                                   CoreState<M> const& state)
+{
+    TrackOrder const torder = params.init()->track_order();
+    if (state.has_action_range() && is_action_sorted(action.order(), torder))
+    {
+        return state.get_action_range(action.action_id());
+    }
+    if (is_status_sorted(action.order(), torder))
+    {
+        CELER_ASSERT(state.counters().num_active <= state.size());
+        return range(ThreadId{state.counters().num_active});
+    }
+    return range(ThreadId{state.size()});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -14,6 +14,7 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "corecel/grid/UniformGridData.hh"
 #include "celeritas/Types.hh"
 
@@ -30,6 +31,12 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * Grid values that are identical to a previously inserted grid (e.g., the
+ * cross sections of materials with the same composition) are not stored
+ * again: the new grid references the existing values. Because of this, the
+ * inserter must outlive all the grids it builds and should be passed by
+ * reference.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -63,7 +70,7 @@ class ValueGridInserter
     XsIndex operator()(UniformGridData const& log_grid, SpanConstDbl values);
 
   private:
-    CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>> values_;
+    DedupeCollectionBuilder<real_type> values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
 };
 
@@ -29,6 +29,7 @@ struct ImportParticle
     double spin{0};  //!< [Multiple of hbar]
     double lifetime{0};  //!< [time]
     bool is_stable{false};
+    bool user_special_cuts{false};  //!< Region user limits apply
 };
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,10 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Store region description and attributes.
+ *
+ * The minimum kinetic energy from the region's user limits (if any) is used
+ * as the tracking cut for the physics materials in the region, for particles
+ * that have a \c G4UserSpecialCuts process.
  */
 struct ImportRegion
 {
@@ -21,6 +25,7 @@ struct ImportRegion
     bool field_manager{false};
     bool production_cuts{false};
     bool user_limits{false};
+    double min_energy{0};  //!< User-limited kinetic energy [MeV]
 };
 
 //---------------------------------------------------------------------------//
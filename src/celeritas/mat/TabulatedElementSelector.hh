@@ -7,11 +7,14 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/grid/UniformGrid.hh"
 #include "celeritas/Types.hh"
-#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/grid/XsGridData.hh"
 #include "celeritas/phys/PhysicsData.hh"
 #include "celeritas/random/distribution/GenerateCanonical.hh"
 
@@ -25,6 +28,11 @@ namespace celeritas
  * precalculated cross section CDF tables of the elements in the material.
  * Unlike \c ElementSelector which calculates the microscopic cross sections on
  * the fly, this interpolates the values using tabulated CDF grids.
+ *
+ * The CDF grids of all elements in a material share the same energy grid, so
+ * the energy bin and interpolation fraction are calculated only once on
+ * construction. Sampling is then a linear interpolation of each element's
+ * CDF value in the bin until the sampled value is exceeded.
  */
 class TabulatedElementSelector
 {
@@ -57,7 +65,10 @@ class TabulatedElementSelector
     GridValues const& grids_;
     GridIdValues const& ids_;
     Values const& reals_;
-    Energy const energy_;
+    size_type lower_idx_{0};
+    real_type frac_{0};
+
+    inline CELER_FUNCTION real_type calc_cdf(size_type elcomp_idx) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -72,9 +83,34 @@ TabulatedElementSelector::TabulatedElementSelector(ValueTable const& table,
                                                    GridIdValues const& ids,
                                                    Values const& reals,
                                                    Energy energy)
-    : table_(table), grids_(grids), ids_(ids), reals_(reals), energy_(energy)
+    : table_(table), grids_(grids), ids_(ids), reals_(reals)
 {
     CELER_EXPECT(table);
+
+    // Locate the energy bin using the grid of the first element
+    ValueGridId grid_id = ids_[table_.grids.front()];
+    CELER_ASSERT(grid_id < grids_.size());
+    UniformGrid const loge_grid(grids_[grid_id].log_energy);
+    real_type const loge = std::log(energy.value());
+    if (loge <= loge_grid.front())
+    {
+        // Clamp to the lowest CDF values
+        return;
+    }
+    if (loge >= loge_grid.back())
+    {
+        // Clamp to the highest CDF values
+        lower_idx_ = loge_grid.size() - 2;
+        frac_ = 1;
+        return;
+    }
+
+    // Interpolate *linearly* on energy, consistent with XsCalculator
+    lower_idx_ = loge_grid.find(loge);
+    CELER_ASSERT(lower_idx_ + 1 < loge_grid.size());
+    real_type const lower_energy = std::exp(loge_grid[lower_idx_]);
+    real_type const upper_energy = std::exp(loge_grid[lower_idx_ + 1]);
+    frac_ = (energy.value() - lower_energy) / (upper_energy - lower_energy);
 }
 
 //---------------------------------------------------------------------------//
@@ -89,14 +125,28 @@ TabulatedElementSelector::operator()(Engine& rng) const
     real_type u = generate_canonical(rng);
     for (; i < table_.grids.size() - 1; ++i)
     {
-        ValueGridId grid_id = ids_[table_.grids[i]];
-        CELER_ASSERT(grid_id < grids_.size());
-        XsCalculator calc_xs(grids_[grid_id], reals_);
-        if (calc_xs(energy_) > u)
+        if (this->calc_cdf(i) > u)
             break;
     }
     return ElementComponentId{i};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the CDF of the given element at the preselected energy.
+ */
+CELER_FUNCTION real_type
+TabulatedElementSelector::calc_cdf(size_type elcomp_idx) const
+{
+    ValueGridId grid_id = ids_[table_.grids[elcomp_idx]];
+    CELER_ASSERT(grid_id < grids_.size());
+    XsGridData const& grid = grids_[grid_id];
+    CELER_ASSERT(lower_idx_ + 1 < grid.value.size());
+    CELER_ASSERT(grid.prime_index == XsGridData::no_scaling());
+    real_type const lower = reals_[grid.value[lower_idx_]];
+    real_type const upper = reals_[grid.value[lower_idx_ + 1]];
+    return lower + frac_ * (upper - lower);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
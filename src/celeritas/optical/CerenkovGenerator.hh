@@ -13,11 +13,11 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayOperators.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/grid/GenericCalculator.hh"
-#include "celeritas/random/distribution/BernoulliDistribution.hh"
-#include "celeritas/random/distribution/RejectionSampler.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
 #include "celeritas/random/distribution/UniformRealDistribution.hh"
 
 #include "CerenkovDndxCalculator.hh"
@@ -46,6 +46,20 @@ namespace optical
  * \f$ \epsilon \f$ is sampled from the PDF \f[
    f(\epsilon) = \left[1 - \frac{1}{n^2(\epsilon)\beta^2}\right]
  * \f]
+ * above the threshold energy \f$ \epsilon_\text{min} \f$ where
+ * \f$ n \beta = 1 \f$. Its cumulative distribution, \f[
+   F(\epsilon) = \epsilon - \epsilon_\text{min} - \frac{1}{\beta^2}
+   \left[I(\epsilon) - I(\epsilon_\text{min})\right],
+ * \f]
+ * is linear in \f$ \beta^{-2} \f$, so the tabulated Cerenkov angle integral
+ * \f$ I \f$ already used for \f$ \difd{N}{x} \f$ provides the exact CDF at
+ * the grid points for any \f$ \beta \f$. The photon energy is sampled
+ * without rejection by a binary search on the CDF at the grid points followed
+ * by linear inversion inside the bin, consistent with the linearly
+ * interpolated angle integral used to calculate the number of photons.
+ *
+ * The position along the step is sampled by directly inverting the
+ * cumulative distribution of the linearly varying mean number of photons.
  */
 class CerenkovGenerator
 {
@@ -69,16 +83,29 @@ class CerenkovGenerator
 
     GeneratorDistributionData const& dist_;
     GenericCalculator calc_refractive_index_;
+    GenericCalculator calc_integral_;
     UniformRealDist sample_phi_;
-    UniformRealDist sample_num_photons_;
-    UniformRealDist sample_energy_;
+    UniformRealDist sample_cdf_;
     Real3 dir_;
     Real3 delta_pos_;
     units::LightSpeed delta_speed_;
     real_type delta_num_photons_;
     real_type dndx_pre_;
-    real_type sin_max_sq_;
     real_type inv_beta_;
+    real_type energy_min_;
+    real_type integral_min_;
+    size_type first_index_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Calculate the CDF at a grid point above the threshold
+    inline CELER_FUNCTION real_type cdf(size_type index) const;
+
+    // Sample the photon energy
+    inline CELER_FUNCTION real_type sample_energy(real_type target) const;
+
+    // Sample the fraction along the step
+    inline CELER_FUNCTION real_type sample_step_fraction(real_type xi) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -93,6 +120,8 @@ CerenkovGenerator::CerenkovGenerator(MaterialView const& material,
                                      GeneratorDistributionData const& dist)
     : dist_(dist)
     , calc_refractive_index_(material.make_refractive_index_calculator())
+    , calc_integral_{shared.angle_integral[material.material_id()],
+                     shared.reals}
     , sample_phi_(0, 2 * constants::pi)
 {
     CELER_EXPECT(shared);
@@ -109,19 +138,28 @@ CerenkovGenerator::CerenkovGenerator(MaterialView const& material,
     dndx_pre_ = calc_dndx(pre_step.speed);
     real_type dndx_post = calc_dndx(post_step.speed);
 
-    // Helper used to sample the displacement
-    sample_num_photons_ = UniformRealDist(0, max(dndx_pre_, dndx_post));
-
-    // Helper to sample exiting photon energies
-    auto const& energy_grid = calc_refractive_index_.grid();
-    sample_energy_ = UniformRealDist(energy_grid.front(), energy_grid.back());
-
-    // Calculate 1 / beta and the max sin^2 theta
+    // Calculate 1 / beta
     inv_beta_
         = 2 / (value_as<LS>(pre_step.speed) + value_as<LS>(post_step.speed));
     CELER_ASSERT(inv_beta_ > 1);
-    real_type cos_max = inv_beta_ / calc_refractive_index_(energy_grid.back());
-    sin_max_sq_ = 1 - ipow<2>(cos_max);
+
+    // Find the threshold energy and the first grid point above it
+    auto const& energy_grid = calc_refractive_index_.grid();
+    energy_min_ = energy_grid.front();
+    first_index_ = 1;
+    if (inv_beta_ >= calc_refractive_index_[0])
+    {
+        energy_min_ = calc_refractive_index_.make_inverse()(inv_beta_);
+        CELER_ASSERT(energy_min_ < energy_grid.back());
+        first_index_ = energy_grid.find(energy_min_) + 1;
+    }
+    CELER_ASSERT(first_index_ < energy_grid.size());
+    integral_min_ = calc_integral_(energy_min_);
+
+    // Helper to sample the CDF
+    real_type cdf_max = this->cdf(energy_grid.size() - 1);
+    CELER_ASSERT(cdf_max > 0);
+    sample_cdf_ = UniformRealDist(0, cdf_max);
 
     // Calculate changes over the step
     delta_pos_ = post_step.pos - pre_step.pos;
@@ -140,28 +178,10 @@ template<class Generator>
 CELER_FUNCTION TrackInitializer CerenkovGenerator::operator()(Generator& rng)
 {
     // Sample energy and direction
-    real_type energy;
-    real_type cos_theta;
-    real_type sin_theta_sq;
-    do
-    {
-        // Sample an energy uniformly within the grid bounds, rejecting
-        // if the refractive index at the sampled energy is such that the
-        // incident particle's average speed is subluminal at that photon
-        // wavelength.
-        // We could improve sampling efficiency for this edge case by
-        // increasing the minimum energy (as is done in
-        // CerenkovDndxCalculator) to where the refractive index satisfies
-        // this condition, but since fewer photons are emitted at lower
-        // energies in general, relatively few rejections will take place
-        // here.
-        do
-        {
-            energy = sample_energy_(rng);
-            cos_theta = inv_beta_ / calc_refractive_index_(energy);
-        } while (cos_theta > 1);
-        sin_theta_sq = 1 - ipow<2>(cos_theta);
-    } while (RejectionSampler{sin_theta_sq, sin_max_sq_}(rng));
+    real_type energy = this->sample_energy(sample_cdf_(rng));
+    real_type cos_theta
+        = min(inv_beta_ / calc_refractive_index_(energy), real_type{1});
+    real_type sin_theta_sq = 1 - ipow<2>(cos_theta);
 
     // Sample azimuthal photon direction
     real_type phi = sample_phi_(rng);
@@ -174,12 +194,7 @@ CELER_FUNCTION TrackInitializer CerenkovGenerator::operator()(Generator& rng)
         = rotate(from_spherical(-std::sqrt(sin_theta_sq), phi), dir_);
 
     // Sample fraction along the step
-    UniformRealDistribution sample_step_fraction;
-    real_type u;
-    do
-    {
-        u = sample_step_fraction(rng);
-    } while (sample_num_photons_(rng) > dndx_pre_ + u * delta_num_photons_);
+    real_type u = this->sample_step_fraction(generate_canonical(rng));
 
     real_type delta_time
         = u * dist_.step_length
@@ -188,9 +203,93 @@ CELER_FUNCTION TrackInitializer CerenkovGenerator::operator()(Generator& rng)
     photon.time = dist_.time + delta_time;
     photon.position = dist_.points[StepPoint::pre].pos;
     axpy(u, delta_pos_, &photon.position);
+    photon.weight = dist_.weight;
+    photon.event_id = dist_.event_id;
     return photon;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the CDF at a grid point above the threshold energy.
+ */
+CELER_FUNCTION real_type CerenkovGenerator::cdf(size_type index) const
+{
+    CELER_EXPECT(index >= first_index_);
+    return calc_refractive_index_.grid()[index] - energy_min_
+           - ipow<2>(inv_beta_) * (calc_integral_[index] - integral_min_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the photon energy by inverting the CDF.
+ *
+ * The CDF is increasing above the first grid point past the threshold. It may
+ * be slightly negative there if the threshold is very close to that grid
+ * point, in which case the target value is always found above it.
+ */
+CELER_FUNCTION real_type
+CerenkovGenerator::sample_energy(real_type target) const
+{
+    auto const& energy_grid = calc_refractive_index_.grid();
+
+    // Find the last grid point whose CDF does not exceed the target
+    size_type lower = first_index_;
+    size_type upper = energy_grid.size() - 1;
+    real_type lower_cdf = this->cdf(lower);
+    if (target < lower_cdf)
+    {
+        // Target is between the threshold and the first grid point above it
+        return energy_min_
+               + (energy_grid[lower] - energy_min_) * (target / lower_cdf);
+    }
+    while (upper - lower > 1)
+    {
+        size_type mid = lower + (upper - lower) / 2;
+        real_type mid_cdf = this->cdf(mid);
+        if (target < mid_cdf)
+        {
+            upper = mid;
+        }
+        else
+        {
+            lower = mid;
+            lower_cdf = mid_cdf;
+        }
+    }
+
+    // Invert the linear CDF inside the bin
+    real_type upper_cdf = this->cdf(upper);
+    CELER_ASSERT(upper_cdf > lower_cdf);
+    real_type energy = energy_grid[lower]
+                       + (energy_grid[upper] - energy_grid[lower])
+                             * (target - lower_cdf) / (upper_cdf - lower_cdf);
+    return min(energy, energy_grid[upper]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the fraction along the step where the photon is emitted.
+ *
+ * The mean number of photons per unit length varies linearly from \em a at
+ * the pre-step point to \em a + \em b at the post-step point, so the
+ * fraction \em u is the root of \f$ a u + b u^2 / 2 = \xi (a + b / 2) \f$,
+ * written in a form that is stable for small \em b .
+ */
+CELER_FUNCTION real_type
+CerenkovGenerator::sample_step_fraction(real_type xi) const
+{
+    real_type const a = dndx_pre_;
+    real_type const b = delta_num_photons_;
+    real_type const c = xi * (a + b / 2);
+    real_type const denom
+        = a + std::sqrt(clamp_to_nonneg(ipow<2>(a) + 2 * b * c));
+    if (denom <= 0)
+    {
+        return 0;
+    }
+    return min(2 * c / denom, real_type{1});
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace optical
 }  // namespace celeritas
@@ -34,6 +34,10 @@ namespace celeritas
    \langle n \rangle = \ell_\text{step} \difd{N}{x}
  * \f]
  * where \f$ \ell_\text{step} \f$ is the step length.
+ *
+ * If the pre-step data specifies a survival probability \em p less than
+ * unity, the mean is reduced by a factor \em p (equivalent to independently
+ * discarding each photon) and the photons are weighted by \f$ 1/p \f$.
  */
 class CerenkovOffload
 {
@@ -106,10 +110,13 @@ CerenkovOffload::operator()(Generator& rng)
     }
 
     optical::GeneratorDistributionData data;
-    data.num_photons = PoissonDistribution<real_type>(num_photons_per_len_
-                                                      * step_length_)(rng);
+    data.num_photons = PoissonDistribution<real_type>(
+        num_photons_per_len_ * step_length_ * pre_step_.survival_probability)(
+        rng);
     if (data.num_photons > 0)
     {
+        data.weight = pre_step_.weight / pre_step_.survival_probability;
+        data.event_id = pre_step_.event_id;
         data.time = pre_step_.time;
         data.step_length = step_length_;
         data.charge = charge_;
@@ -104,7 +104,8 @@ CELER_FUNCTION CoreTrackView&
 CoreTrackView::operator=(TrackInitializer const& init)
 {
     // Initialiize the sim state
-    this->sim() = SimTrackView::Initializer{init.time};
+    this->sim() = SimTrackView::Initializer{
+        init.time, init.weight, init.event_id};
 
     // Initialize the geometry state
     auto geo = this->geometry();
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/DetectorData.cc
+//---------------------------------------------------------------------------//
+#include "DetectorData.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize based on the number of track slots.
+ */
+template<MemSpace M>
+void resize(DetectorStateData<Ownership::value, M>* state,
+            HostCRef<DetectorParamsData> const& params,
+            StreamId,
+            size_type size)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(size > 0);
+
+    resize(&state->hits, size);
+    resize(&state->num_hits, 1);
+    fill(size_type{0}, &state->num_hits);
+
+    // Zero the run tallies
+    for (auto* tally : {&state->count, &state->wavelength, &state->overflow})
+    {
+        resize(tally, params.num_detectors);
+        fill(real_type{0}, tally);
+    }
+    resize(&state->time_hist, params.num_detectors * params.num_time_bins);
+    fill(real_type{0}, &state->time_hist);
+
+    CELER_ENSURE(*state);
+}
+
+//---------------------------------------------------------------------------//
+
+template void resize(DetectorStateData<Ownership::value, MemSpace::host>*,
+                     HostCRef<DetectorParamsData> const&,
+                     StreamId,
+                     size_type);
+template void resize(DetectorStateData<Ownership::value, MemSpace::device>*,
+                     HostCRef<DetectorParamsData> const&,
+                     StreamId,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/DetectorData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Optical photon that entered a sensor volume during the current step.
+ */
+struct DetectorHit
+{
+    DetectorId detector;
+    EventId event;  //!< Event of the parent track
+    real_type time{};  //!< Arrival time [time]
+    units::MevEnergy energy;  //!< Photon energy
+    real_type weight{};  //!< Statistical weight of the photon
+
+    //! Whether a photon was detected
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return static_cast<bool>(detector);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sensor volumes and arrival-time histogram binning.
+ *
+ * The time histogram has \c num_time_bins uniform bins on [0, time_max);
+ * photons arriving later are tallied separately as overflow.
+ */
+template<Ownership W, MemSpace M>
+struct DetectorParamsData
+{
+    //// DATA ////
+
+    //! Detector ID for each volume (null if not a sensor)
+    Collection<DetectorId, W, M, VolumeId> detector;
+
+    DetectorId::size_type num_detectors{0};
+    size_type num_time_bins{0};
+    real_type time_max{0};
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !detector.empty() && num_detectors > 0 && num_time_bins > 0
+               && time_max > 0;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    DetectorParamsData& operator=(DetectorParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        detector = other.detector;
+        num_detectors = other.num_detectors;
+        num_time_bins = other.num_time_bins;
+        time_max = other.time_max;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-stream detector hits and run tallies.
+ *
+ * Hits from the current step are compacted at the front of \c hits and
+ * counted by \c num_hits, which is reset every step. The run tallies are
+ * accumulated on the stream's memory space and only reduced across streams
+ * when output is requested.
+ */
+template<Ownership W, MemSpace M>
+struct DetectorStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using DetItems = Collection<T, W, M, DetectorId>;
+    template<class T>
+    using StateItems = StateCollection<T, W, M>;
+
+    //// DATA ////
+
+    //! Hits recorded during the current step
+    StateItems<DetectorHit> hits;
+    //! Number of hits recorded during the current step (single element)
+    Items<size_type> num_hits;
+
+    //! Weighted photon count
+    DetItems<real_type> count;
+    //! Weighted sum of photon wavelengths [length]
+    DetItems<real_type> wavelength;
+    //! Weighted arrival times [detector * num_time_bins + bin]
+    Items<real_type> time_hist;
+    //! Weighted count of photons arriving after time_max
+    DetItems<real_type> overflow;
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return hits.size(); }
+
+    //! True if constructed
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !hits.empty() && num_hits.size() == 1 && !count.empty()
+               && wavelength.size() == count.size() && !time_hist.empty()
+               && overflow.size() == count.size();
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    DetectorStateData& operator=(DetectorStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        hits = other.hits;
+        num_hits = other.num_hits;
+        count = other.count;
+        wavelength = other.wavelength;
+        time_hist = other.time_hist;
+        overflow = other.overflow;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Resize based on the number of track slots
+template<MemSpace M>
+void resize(DetectorStateData<Ownership::value, M>* state,
+            HostCRef<DetectorParamsData> const& params,
+            StreamId,
+            size_type size);
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
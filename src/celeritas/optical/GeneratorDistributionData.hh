@@ -44,6 +44,8 @@ struct GeneratorStepData
 struct GeneratorDistributionData
 {
     size_type num_photons{};  //!< Sampled number of photons to generate
+    real_type weight{1};  //!< Statistical weight of each photon
+    EventId event_id;  //!< Event of the parent track
     real_type time{};  //!< Pre-step time
     real_type step_length{};
     units::ElementaryCharge charge;
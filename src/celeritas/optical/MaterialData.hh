@@ -38,6 +38,11 @@ struct MaterialParamsData
     OpticalMaterialItems<GenericGridRecord> refractive_index;
     VolumeItems<OpticalMaterialId> optical_id;
 
+    //! Fraction of generated photons to keep (empty if all are kept)
+    OpticalMaterialItems<real_type> survival_probability;
+    //! Whether photons are killed in each volume (empty for none)
+    VolumeItems<char> kill_volume;
+
     // Backend data
     Items<real_type> reals;
 
@@ -57,6 +62,8 @@ struct MaterialParamsData
         CELER_EXPECT(other);
         refractive_index = other.refractive_index;
         optical_id = other.optical_id;
+        survival_probability = other.survival_probability;
+        kill_volume = other.kill_volume;
         reals = other.reals;
         return *this;
     }
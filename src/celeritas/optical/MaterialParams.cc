@@ -15,6 +15,7 @@
 #include "corecel/grid/VectorUtils.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/math/Algorithms.hh"
+#include "geocel/GeoParamsInterface.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
@@ -27,14 +28,16 @@ namespace celeritas
 {
 namespace optical
 {
+namespace
+{
 //---------------------------------------------------------------------------//
 /*!
- * Construct with imported data and material/volume data.
+ * Construct the input from imported data and material/volume data.
  */
-std::shared_ptr<MaterialParams>
-MaterialParams::from_import(ImportData const& data,
-                            ::celeritas::GeoMaterialParams const& geo_mat,
-                            ::celeritas::MaterialParams const& mat)
+MaterialParams::Input
+make_input(ImportData const& data,
+           ::celeritas::GeoMaterialParams const& geo_mat,
+           ::celeritas::MaterialParams const& mat)
 {
     CELER_EXPECT(!data.optical_materials.empty());
     CELER_EXPECT(geo_mat.num_volumes() > 0);
@@ -46,7 +49,7 @@ MaterialParams::from_import(ImportData const& data,
                                }),
                    << "one or more optical materials lack required data");
 
-    Input inp;
+    MaterialParams::Input inp;
 
     // Extract optical material properties
     inp.properties.reserve(data.optical_materials.size());
@@ -76,6 +79,72 @@ MaterialParams::from_import(ImportData const& data,
                    << "no volumes have associated optical materials");
 
     CELER_ENSURE(inp.volume_to_mat.size() == geo_mat.num_volumes());
+    return inp;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with imported data and material/volume data.
+ */
+std::shared_ptr<MaterialParams>
+MaterialParams::from_import(ImportData const& data,
+                            ::celeritas::GeoMaterialParams const& geo_mat,
+                            ::celeritas::MaterialParams const& mat)
+{
+    return std::make_shared<MaterialParams>(make_input(data, geo_mat, mat));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with imported data, material/volume data, and user options.
+ *
+ * Survival probabilities are given by (geometry) material name and apply to
+ * the optical material of every material with that name; other optical
+ * materials track all photons. Kill volumes are given by name and include
+ * all volumes that share the name.
+ */
+std::shared_ptr<MaterialParams>
+MaterialParams::from_import(ImportData const& data,
+                            GeoParamsInterface const& geo,
+                            ::celeritas::GeoMaterialParams const& geo_mat,
+                            ::celeritas::MaterialParams const& mat,
+                            ImportOptions const& options)
+{
+    auto inp = make_input(data, geo_mat, mat);
+
+    if (!options.survival_probability.empty())
+    {
+        inp.survival_probability.assign(inp.properties.size(), 1);
+        for (auto const& [name, prob] : options.survival_probability)
+        {
+            auto mat_ids = mat.find_materials(name);
+            CELER_VALIDATE(!mat_ids.empty(),
+                           << "no material named '" << name
+                           << "' for optical photon survival probability");
+            for (MaterialId mat_id : mat_ids)
+            {
+                auto optmat = mat.get(mat_id).optical_material_id();
+                CELER_VALIDATE(optmat,
+                               << "material '" << name
+                               << "' has no optical properties");
+                inp.survival_probability[optmat.get()] = prob;
+            }
+        }
+    }
+
+    for (std::string const& name : options.kill_volumes)
+    {
+        auto vol_ids = geo.find_volumes(name);
+        CELER_VALIDATE(!vol_ids.empty(),
+                       << "no volume named '" << name
+                       << "' for optical photon kill volume");
+        inp.kill_volumes.insert(
+            inp.kill_volumes.end(), vol_ids.begin(), vol_ids.end());
+    }
+
     return std::make_shared<MaterialParams>(std::move(inp));
 }
 
@@ -129,6 +198,38 @@ MaterialParams::MaterialParams(Input const& inp)
     CollectionBuilder{&data.optical_id}.insert_back(inp.volume_to_mat.begin(),
                                                     inp.volume_to_mat.end());
 
+    if (!inp.survival_probability.empty())
+    {
+        CELER_VALIDATE(
+            inp.survival_probability.size() == inp.properties.size(),
+            << "number of optical photon survival probabilities ("
+            << inp.survival_probability.size()
+            << ") does not match the number of optical materials ("
+            << inp.properties.size() << ")");
+        for (real_type p : inp.survival_probability)
+        {
+            CELER_VALIDATE(p > 0 && p <= 1,
+                           << "invalid optical photon survival probability "
+                           << p << " (should be in (0, 1])");
+        }
+        CollectionBuilder{&data.survival_probability}.insert_back(
+            inp.survival_probability.begin(), inp.survival_probability.end());
+    }
+
+    if (!inp.kill_volumes.empty())
+    {
+        std::vector<char> kill_volume(inp.volume_to_mat.size(), false);
+        for (VolumeId vid : inp.kill_volumes)
+        {
+            CELER_VALIDATE(vid < kill_volume.size(),
+                           << "optical kill volume ID " << vid.unchecked_get()
+                           << " is out of range");
+            kill_volume[vid.get()] = true;
+        }
+        CollectionBuilder{&data.kill_volume}.insert_back(kill_volume.begin(),
+                                                         kill_volume.end());
+    }
+
     data_ = CollectionMirror<MaterialParamsData>{std::move(data)};
     CELER_ENSURE(data_);
 }
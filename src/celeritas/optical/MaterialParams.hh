@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
+#include <string>
 #include <vector>
 
 #include "corecel/Types.hh"
@@ -21,6 +23,7 @@ namespace celeritas
 struct ImportData;
 class MaterialParams;
 class GeoMaterialParams;
+class GeoParamsInterface;
 
 namespace optical
 {
@@ -41,6 +44,13 @@ namespace optical
  * GeoMaterialParams which maps volumes to \c MaterialId, this class maps the
  * geometry volumes to optical materials for use in the optical tracking loop.
  *
+ * Photon counts can be reduced for detectors where only a small fraction of
+ * photons is of interest: a per-material survival probability thins the
+ * number of photons sampled at generation (with the photon weights increased
+ * accordingly), and photons are killed on entering any of the "kill volumes".
+ * When constructing from imported data, these are specified by material and
+ * volume name using \c ImportOptions .
+ *
  * When surface models are implemented, surface properties will also be added
  * to this class.
  */
@@ -53,6 +63,19 @@ class MaterialParams final : public ParamsDataInterface<MaterialParamsData>
         std::vector<ImportOpticalProperty> properties;
         //! Map logical volume ID to optical material ID
         std::vector<OpticalMaterialId> volume_to_mat;
+        //! Fraction of generated photons to track (optional, per material)
+        std::vector<real_type> survival_probability;
+        //! Volumes in which optical photons are killed (optional)
+        std::vector<VolumeId> kill_volumes;
+    };
+
+    //! User options for photon count reduction
+    struct ImportOptions
+    {
+        //! Fraction of generated photons to track, by material name
+        std::map<std::string, real_type> survival_probability;
+        //! Names of volumes in which optical photons are killed
+        std::vector<std::string> kill_volumes;
     };
 
   public:
@@ -62,6 +85,14 @@ class MaterialParams final : public ParamsDataInterface<MaterialParamsData>
                 ::celeritas::GeoMaterialParams const& geo_mat,
                 ::celeritas::MaterialParams const& mat);
 
+    // Construct with imported data, materials, and user options
+    static std::shared_ptr<MaterialParams>
+    from_import(ImportData const& data,
+                GeoParamsInterface const& geo,
+                ::celeritas::GeoMaterialParams const& geo_mat,
+                ::celeritas::MaterialParams const& mat,
+                ImportOptions const& options);
+
     // Construct with optical property data
     explicit MaterialParams(Input const& inp);
 
@@ -46,6 +46,12 @@ class MaterialView
     // ID of this optical material
     CELER_FORCEINLINE_FUNCTION MaterialId material_id() const;
 
+    // Fraction of generated photons to track
+    inline CELER_FUNCTION real_type survival_probability() const;
+
+    // Whether photons are killed in the volume
+    inline CELER_FUNCTION bool is_kill_volume() const;
+
     //// PARAMETER DATA ////
 
     // Access energy-dependent refractive index
@@ -57,6 +63,7 @@ class MaterialView
 
     ParamsRef const& params_;
     MaterialId mat_id_;
+    VolumeId vol_id_;
 };
 
 //---------------------------------------------------------------------------//
@@ -78,7 +85,7 @@ MaterialView::MaterialView(ParamsRef const& params, MaterialId id)
  */
 CELER_FUNCTION
 MaterialView::MaterialView(ParamsRef const& params, VolumeId id)
-    : params_{params}
+    : params_{params}, vol_id_{id}
 {
     CELER_EXPECT(id < params_.optical_id.size());
     mat_id_ = params_.optical_id[id];
@@ -105,6 +112,35 @@ CELER_FUNCTION auto MaterialView::material_id() const -> MaterialId
     return mat_id_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fraction of generated photons to track.
+ *
+ * Photons produced in this material are thinned by this probability at
+ * generation and weighted by its inverse.
+ */
+CELER_FUNCTION real_type MaterialView::survival_probability() const
+{
+    CELER_EXPECT(*this);
+    if (params_.survival_probability.empty())
+    {
+        return 1;
+    }
+    return params_.survival_probability[mat_id_];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether photons are killed in the volume.
+ *
+ * \pre The view must have been constructed from a volume.
+ */
+CELER_FUNCTION bool MaterialView::is_kill_volume() const
+{
+    CELER_EXPECT(vol_id_);
+    return !params_.kill_volume.empty() && params_.kill_volume[vol_id_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access energy-dependent refractive index.
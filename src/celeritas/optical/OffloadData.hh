@@ -92,6 +92,9 @@ struct OffloadPreStepData
     units::LightSpeed speed;
     Real3 pos{};
     real_type time{};
+    real_type weight{1};  //!< Statistical weight of the parent track
+    EventId event_id;  //!< Event of the parent track
+    real_type survival_probability{1};  //!< Fraction of photons to sample
     OpticalMaterialId material;
 
     //! Check whether the data are assigned
@@ -8,6 +8,7 @@
 #include "OpticalCollector.hh"
 
 #include "corecel/data/AuxParamsRegistry.hh"
+#include "corecel/io/OutputRegistry.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -52,7 +53,7 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
     // Action to gather pre-step data needed to generate optical distributions
     ActionRegistry& actions = *core.action_reg();
     gather_action_ = std::make_shared<detail::OffloadGatherAction>(
-        actions.next_id(), offload_params_->aux_id());
+        actions.next_id(), offload_params_->aux_id(), inp.material);
     actions.insert(gather_action_);
 
     if (setup.cerenkov)
@@ -106,7 +107,17 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
 
     // Create launch action with optical params+state and access to gen data
     launch_action_ = detail::OpticalLaunchAction::make_and_insert(
-        core, inp.material, offload_params_, inp.primary_capacity);
+        core,
+        inp.material,
+        offload_params_,
+        inp.primary_capacity,
+        std::move(inp.detectors));
+
+    if (auto const& detectors = launch_action_->detector_action())
+    {
+        // Write the sensor tallies with the run results
+        core.output_reg()->insert(detectors);
+    }
 
     // Launch action must be *after* offload and generator actions
     CELER_ENSURE(!cerenkov_action_
@@ -140,5 +151,14 @@ AuxId OpticalCollector::optical_aux_id() const
     return launch_action_->aux_id();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Optical sensor scoring action, if sensors are defined.
+ */
+auto OpticalCollector::detectors() const -> SPDetectorAction const&
+{
+    return launch_action_->detector_action();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
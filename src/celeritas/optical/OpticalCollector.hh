@@ -14,6 +14,8 @@
 
 #include "OffloadData.hh"
 
+#include "action/DetectorAction.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -66,6 +68,7 @@ class OpticalCollector
     using SPConstMaterial = std::shared_ptr<optical::MaterialParams const>;
     using SPConstScintillation
         = std::shared_ptr<optical::ScintillationParams const>;
+    using SPDetectorAction = std::shared_ptr<optical::DetectorAction>;
     //!@}
 
     struct Input
@@ -84,6 +87,9 @@ class OpticalCollector
         //! Threshold number of initializers for launching optical loop
         size_type auto_flush{};
 
+        //! Optional sensor volumes for scoring optical photons
+        optical::DetectorAction::Input detectors;
+
         //! True if all input is assigned and valid
         explicit operator bool() const
         {
@@ -103,6 +109,9 @@ class OpticalCollector
     // Aux ID for optical state data
     AuxId optical_aux_id() const;
 
+    // Optical sensor scoring (null if no sensors are defined)
+    SPDetectorAction const& detectors() const;
+
   private:
     //// TYPES ////
 
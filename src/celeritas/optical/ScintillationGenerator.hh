@@ -168,6 +168,8 @@ CELER_FUNCTION TrackInitializer ScintillationGenerator::operator()(Generator& rn
     real_type u = is_neutral_ ? 1 : UniformRealDist{}(rng);
     photon.position = dist_.points[StepPoint::pre].pos;
     axpy(u, delta_pos_, &photon.position);
+    photon.weight = dist_.weight;
+    photon.event_id = dist_.event_id;
 
     // Sample time
     photon.time
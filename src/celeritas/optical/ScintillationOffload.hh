@@ -9,6 +9,7 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
+#include "corecel/math/Algorithms.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/phys/ParticleTrackView.hh"
 #include "celeritas/random/distribution/NormalDistribution.hh"
@@ -35,6 +36,11 @@ namespace celeritas
  * - for large (n > 10) mean yield, from a Gaussian distribution with a
  *   material-dependent spread, or
  * - for small yields, from a Poisson distribution.
+ *
+ * If the pre-step data specifies a survival probability \em p less than
+ * unity, the number of photons is thinned by \em p (preserving the first two
+ * moments of independently discarding each photon) and the photons are
+ * weighted by \f$ 1/p \f$.
  */
 class ScintillationOffload
 {
@@ -122,22 +128,28 @@ ScintillationOffload::operator()(Generator& rng)
 {
     // Material-only sampling
     optical::GeneratorDistributionData result;
-    if (mean_num_photons_ > poisson_threshold())
+    real_type const p = pre_step_.survival_probability;
+    real_type const mean_num_photons = p * mean_num_photons_;
+    if (mean_num_photons > poisson_threshold())
     {
-        real_type sigma = shared_.resolution_scale[pre_step_.material]
-                          * std::sqrt(mean_num_photons_);
+        // Variance of the thinned count is p^2 sigma^2 + p (1 - p) mean
+        real_type scale = shared_.resolution_scale[pre_step_.material];
+        real_type sigma
+            = std::sqrt(mean_num_photons * (p * ipow<2>(scale) + 1 - p));
         result.num_photons = static_cast<size_type>(clamp_to_nonneg(
-            NormalDistribution<real_type>(mean_num_photons_, sigma)(rng)
+            NormalDistribution<real_type>(mean_num_photons, sigma)(rng)
             + real_type{0.5}));
     }
-    else if (mean_num_photons_ > 0)
+    else if (mean_num_photons > 0)
     {
         result.num_photons = static_cast<size_type>(
-            PoissonDistribution<real_type>(mean_num_photons_)(rng));
+            PoissonDistribution<real_type>(mean_num_photons)(rng));
     }
 
     if (result.num_photons > 0)
     {
+        result.weight = pre_step_.weight / p;
+        result.event_id = pre_step_.event_id;
         // Assign remaining data
         result.time = pre_step_.time;
         result.step_length = step_length_;
@@ -36,6 +36,8 @@ struct SimStateData
     //// DATA ////
 
     Items<real_type> time;  //!< Time elapsed in lab frame since start of event
+    Items<real_type> weight;  //!< Statistical weight
+    Items<EventId> event_id;  //!< Event of the parent track
     Items<real_type> step_length;
     Items<TrackStatus> status;
     Items<ActionId> post_step_action;
@@ -45,8 +47,9 @@ struct SimStateData
     //! Check whether the interface is assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !time.empty() && !step_length.empty() && !status.empty()
-               && !post_step_action.empty();
+        return !time.empty() && !weight.empty() && !event_id.empty()
+               && !step_length.empty()
+               && !status.empty() && !post_step_action.empty();
     }
 
     //! State size
@@ -58,6 +61,8 @@ struct SimStateData
     {
         CELER_EXPECT(other);
         time = other.time;
+        weight = other.weight;
+        event_id = other.event_id;
         step_length = other.step_length;
         status = other.status;
         post_step_action = other.post_step_action;
@@ -75,6 +80,8 @@ inline void resize(SimStateData<Ownership::value, M>* data, size_type size)
     CELER_EXPECT(size > 0);
 
     resize(&data->time, size);
+    resize(&data->weight, size);
+    resize(&data->event_id, size);
     resize(&data->step_length, size);
 
     resize(&data->status, size);
@@ -28,6 +28,8 @@ class SimTrackView
     struct Initializer
     {
         real_type time{};
+        real_type weight{1};
+        EventId event_id;
     };
 
   public:
@@ -64,6 +66,12 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Statistical weight of the photon
+    inline CELER_FUNCTION real_type weight() const;
+
+    // Event of the parent track
+    inline CELER_FUNCTION EventId event_id() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -99,6 +107,8 @@ SimTrackView::SimTrackView(NativeRef<SimStateData> const& states,
 CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer const& init)
 {
     states_.time[track_slot_] = init.time;
+    states_.weight[track_slot_] = init.weight;
+    states_.event_id[track_slot_] = init.event_id;
     states_.step_length[track_slot_] = {};
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.post_step_action[track_slot_] = {};
@@ -208,6 +218,27 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Statistical weight of the photon.
+ *
+ * This is unity unless the photon was generated with a reduced survival
+ * probability or by a weighted parent track.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.weight[track_slot_];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Event of the track that generated the photon.
+ */
+CELER_FORCEINLINE_FUNCTION EventId SimTrackView::event_id() const
+{
+    return states_.event_id[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
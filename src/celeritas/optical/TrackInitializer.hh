@@ -27,6 +27,8 @@ struct TrackInitializer
     Real3 direction{0, 0, 0};
     Real3 polarization{0, 0, 0};
     real_type time{};
+    real_type weight{1};
+    EventId event_id{};
     VolumeId volume{};
 };
 
@@ -38,10 +38,11 @@ template<class F>
 void launch_action(CoreState<MemSpace::host>& state, F&& execute_thread)
 {
     MultiExceptionHandler capture_exception;
+    size_type const size = state.size();
 #if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
 #    pragma omp parallel for
 #endif
-    for (size_type i = 0, size = state.size(); i != size; ++i)
+    for (size_type i = 0; i < size; ++i)
     {
         CELER_TRY_HANDLE(execute_thread(ThreadId{i}), capture_exception);
     }
@@ -0,0 +1,350 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/DetectorAction.cc
+//---------------------------------------------------------------------------//
+#include "DetectorAction.hh"
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Config.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/Copier.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "celeritas/UnitTypes.hh"
+#include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
+#include "celeritas/optical/CoreParams.hh"
+#include "celeritas/optical/CoreState.hh"
+
+#include "ActionLauncher.hh"
+#include "TrackSlotExecutor.hh"
+
+#include "detail/DetectorExecutor.hh"
+#include "detail/DetectorImpl.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID, optical params, and sensor definitions.
+ */
+DetectorAction::DetectorAction(ActionId id,
+                               CoreParams const& params,
+                               Input&& input)
+    : id_{id}
+    , volumes_{std::move(input.volumes)}
+    , callback_{std::move(input.callback)}
+    , streams_(params.max_streams())
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(!volumes_.empty(),
+                   << "no optical detector volumes were specified");
+    CELER_VALIDATE(input.num_time_bins > 0 && input.time_max > 0,
+                   << "invalid optical detector time binning: "
+                   << input.num_time_bins << " bins up to " << input.time_max);
+
+    HostVal<DetectorParamsData> host_params;
+
+    // Map volumes to detector IDs
+    std::vector<DetectorId> detector(params.geometry()->num_volumes());
+    for (auto didx : range<DetectorId::size_type>(volumes_.size()))
+    {
+        VolumeId vid = volumes_[didx];
+        CELER_VALIDATE(vid < detector.size(),
+                       << "optical detector volume ID " << vid.unchecked_get()
+                       << " is out of range");
+        CELER_VALIDATE(!detector[vid.get()],
+                       << "duplicate optical detector volume ID "
+                       << vid.unchecked_get());
+        detector[vid.get()] = DetectorId{didx};
+    }
+    CollectionBuilder{&host_params.detector}.insert_back(detector.begin(),
+                                                         detector.end());
+    host_params.num_detectors = volumes_.size();
+    host_params.num_time_bins = input.num_time_bins;
+    host_params.time_max = input.time_max;
+
+    store_ = {std::move(host_params), params.max_streams()};
+    CELER_ENSURE(store_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view DetectorAction::description() const
+{
+    return "score photons entering optical sensors";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record and tally hits with host data.
+ */
+void DetectorAction::step(CoreParams const& params, CoreStateHost& state) const
+{
+    auto execute = make_action_thread_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        params.host_ref().scalars.boundary_action,
+        detail::DetectorExecutor{
+            store_.params<MemSpace::native>(),
+            this->reset_hits<MemSpace::native>(state.stream_id(),
+                                               state.size())});
+    launch_action(state, execute);
+
+    this->accumulate(state.stream_id(), MemSpace::host);
+}
+
+#if !CELER_USE_DEVICE
+void DetectorAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void DetectorAction::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+    using units::NativeTraits;
+
+    auto obj = json::object();
+
+    {
+        std::vector<int> ids;
+        for (VolumeId vid : volumes_)
+        {
+            ids.push_back(static_cast<int>(vid.get()));
+        }
+        obj["volume_ids"] = std::move(ids);
+    }
+
+    auto const& params = store_.params<MemSpace::host>();
+    obj["time_max"] = params.time_max;
+    obj["count"] = this->calc_counts();
+    obj["wavelength"] = this->calc_mean_wavelengths();
+    obj["overflow"] = this->calc_overflow();
+    {
+        auto hist = this->calc_time_histograms();
+        auto nbins = params.num_time_bins;
+        auto time_hist = json::array();
+        for (auto didx : range(this->num_detectors()))
+        {
+            auto start = hist.begin() + didx * nbins;
+            time_hist.push_back(VecReal(start, start + nbins));
+        }
+        obj["time_hist"] = std::move(time_hist);
+    }
+    {
+        // Photon counts for events that haven't been taken
+        std::map<EventId, Tally> events;
+        for (auto& stream : streams_)
+        {
+            std::lock_guard<std::mutex> scoped_lock{stream.lock};
+            for (auto const& [event, tally] : stream.events)
+            {
+                detail::accumulate_tally(tally, &events[event]);
+            }
+        }
+        auto event_count = json::object();
+        for (auto const& [event, tally] : events)
+        {
+            event_count[std::to_string(event.get())] = tally.count;
+        }
+        obj["event_count"] = std::move(event_count);
+    }
+    obj["_units"] = {
+        {"time_max", NativeTraits::Time::label()},
+        {"wavelength", NativeTraits::Length::label()},
+    };
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the weighted photon count of each detector over the run.
+ */
+auto DetectorAction::calc_counts() const -> VecReal
+{
+    VecReal result(this->num_detectors(), real_type{0});
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.count; }, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the mean photon wavelength of each detector over the run.
+ *
+ * Detectors without any hits have a mean wavelength of zero.
+ */
+auto DetectorAction::calc_mean_wavelengths() const -> VecReal
+{
+    VecReal result(this->num_detectors(), real_type{0});
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.wavelength; }, &result);
+
+    auto counts = this->calc_counts();
+    for (auto i : range(result.size()))
+    {
+        if (counts[i] > 0)
+        {
+            result[i] /= counts[i];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the arrival-time histograms over the run.
+ *
+ * The result is indexed as \c [detector * num_time_bins + bin].
+ */
+auto DetectorAction::calc_time_histograms() const -> VecReal
+{
+    VecReal result(this->num_detectors()
+                       * store_.params<MemSpace::host>().num_time_bins,
+                   real_type{0});
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.time_hist; }, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the weight arriving after the histogram of each detector.
+ */
+auto DetectorAction::calc_overflow() const -> VecReal
+{
+    VecReal result(this->num_detectors(), real_type{0});
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.overflow; }, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove and return the tallies of a completed event.
+ *
+ * This should be called once all tracks from the event (including suspended
+ * tracks) have been transported. The event's tallies are reduced over all
+ * streams. The result is empty if no photons from the event were detected.
+ */
+auto DetectorAction::take_event(EventId event) -> Tally
+{
+    CELER_EXPECT(event);
+
+    Tally result;
+    for (auto& stream : streams_)
+    {
+        std::lock_guard<std::mutex> scoped_lock{stream.lock};
+        if (auto iter = stream.events.find(event);
+            iter != stream.events.end())
+        {
+            detail::accumulate_tally(iter->second, &result);
+            stream.events.erase(iter);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the stream-local state, clearing hits from the previous step.
+ */
+template<MemSpace M>
+DetectorStateData<Ownership::reference, M>&
+DetectorAction::reset_hits(StreamId sid, size_type size) const
+{
+    auto& state = store_.state<M>(sid, size);
+    fill(size_type{0}, &state.num_hits);
+    return state;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add this step's hits to the stream's event tallies.
+ *
+ * Only the compacted hits are copied from device. The stream's lock is only
+ * contended when another thread is taking an event or writing output.
+ */
+void DetectorAction::accumulate(StreamId sid, MemSpace m) const
+{
+    CELER_EXPECT(sid < streams_.size());
+    auto& stream = streams_[sid.unchecked_get()];
+
+    Span<DetectorHit const> hits;
+    if (m == MemSpace::device)
+    {
+        auto const* state = store_.state<MemSpace::device>(sid);
+        CELER_ASSERT(state);
+        size_type num_hits{0};
+        copy_to_host(state->num_hits, Span<size_type>{&num_hits, 1});
+        if (num_hits == 0)
+        {
+            return;
+        }
+        stream.hits.resize(num_hits);
+        Copier<DetectorHit, MemSpace::host> copy{make_span(stream.hits)};
+        copy(MemSpace::device,
+             state->hits[AllItems<DetectorHit, MemSpace::device>{}].first(
+                 num_hits));
+        hits = make_span(stream.hits);
+    }
+    else
+    {
+        auto const* state = store_.state<MemSpace::host>(sid);
+        CELER_ASSERT(state);
+        size_type num_hits = state->num_hits[ItemId<size_type>{0}];
+        if (num_hits == 0)
+        {
+            return;
+        }
+        hits = state->hits[AllItems<DetectorHit>{}].first(num_hits);
+    }
+
+    {
+        // Add to the stream's event tallies
+        auto const& params = store_.params<MemSpace::host>();
+        std::lock_guard<std::mutex> scoped_lock{stream.lock};
+        for (DetectorHit const& hit : hits)
+        {
+            CELER_ASSERT(hit.event);
+            detail::accumulate_hit(params, hit, &stream.events[hit.event]);
+        }
+    }
+
+    if (callback_)
+    {
+        callback_(sid, hits);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template DetectorStateData<Ownership::reference, MemSpace::host>&
+DetectorAction::reset_hits<MemSpace::host>(StreamId, size_type) const;
+template DetectorStateData<Ownership::reference, MemSpace::device>&
+DetectorAction::reset_hits<MemSpace::device>(StreamId, size_type) const;
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,45 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/DetectorAction.cu
+//---------------------------------------------------------------------------//
+#include "DetectorAction.hh"
+
+#include "celeritas/optical/CoreParams.hh"
+#include "celeritas/optical/CoreState.hh"
+
+#include "ActionLauncher.device.hh"
+#include "TrackSlotExecutor.hh"
+
+#include "detail/DetectorExecutor.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record hits and tally the run on device.
+ */
+void DetectorAction::step(CoreParams const& params, CoreStateDevice& state) const
+{
+    auto execute = make_action_thread_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        params.host_ref().scalars.boundary_action,
+        detail::DetectorExecutor{
+            store_.params<MemSpace::native>(),
+            this->reset_hits<MemSpace::native>(state.stream_id(),
+                                               state.size())});
+
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(state, execute);
+
+    this->accumulate(state.stream_id(), MemSpace::device);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/DetectorAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+#include "corecel/data/StreamStore.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/optical/DetectorData.hh"
+
+#include "ActionInterface.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Score optical photons entering sensor volumes.
+ *
+ * Each sensor volume is assigned a detector ID corresponding to its index in
+ * the input. A photon that crosses into a sensor is absorbed: it is killed
+ * after its weight is added to the detector's photon count, weighted
+ * wavelength sum, and arrival-time histogram.
+ *
+ * Hits are compacted into a per-stream list during the step, and the run
+ * tallies are accumulated in the stream state on the same memory space. Only
+ * the compacted hits are copied to host, where they are added to the
+ * stream's tallies for the event of the photon's parent track. Since tracks
+ * from one event may be transported on several streams (e.g. when suspended
+ * tracks are resumed), tallies are reduced across streams only when an event
+ * is taken with \c take_event or when output is written. Photons arriving
+ * after \c time_max are tallied as overflow rather than in the histogram.
+ * Any remaining event tallies and the run tallies are written to the \c
+ * result output category. An optional callback receives the individual hits
+ * from each step.
+ */
+class DetectorAction final : public OpticalStepActionInterface,
+                             public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using HitCallback = std::function<void(StreamId, Span<DetectorHit const>)>;
+    using VecReal = std::vector<real_type>;
+    //!@}
+
+    //! Weighted tallies for each detector (empty if nothing was detected)
+    struct Tally
+    {
+        VecReal count;  //!< Photon count
+        VecReal wavelength;  //!< Sum of photon wavelengths [length]
+        VecReal time_hist;  //!< Arrival times [detector * num_bins + bin]
+        VecReal overflow;  //!< Arrivals after time_max [detector]
+    };
+
+    //! Sensor definitions and scoring options
+    struct Input
+    {
+        //! Sensor volumes: detector ID is the index in this list
+        std::vector<VolumeId> volumes;
+        //! Number of uniform arrival-time bins
+        size_type num_time_bins{1};
+        //! Upper edge of the arrival-time histogram [time]
+        real_type time_max{0};
+        //! Optional function called with the hits from each step
+        HitCallback callback;
+
+        //! True if sensors are defined
+        explicit operator bool() const
+        {
+            return !volumes.empty() && num_time_bins > 0 && time_max > 0;
+        }
+    };
+
+  public:
+    // Construct with ID, optical params, and sensor definitions
+    DetectorAction(ActionId id, CoreParams const& params, Input&& input);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "optical-detector"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::post; }
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //!@{
+    //! \name Output interface
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+    //!@}
+
+    //! Number of sensors
+    DetectorId::size_type num_detectors() const { return volumes_.size(); }
+
+    // Get the weighted photon count of each detector over the run
+    VecReal calc_counts() const;
+
+    // Get the mean photon wavelength of each detector over the run
+    VecReal calc_mean_wavelengths() const;
+
+    // Get the arrival-time histograms [detector][bin] over the run
+    VecReal calc_time_histograms() const;
+
+    // Get the weight arriving after the histogram of each detector
+    VecReal calc_overflow() const;
+
+    // Remove and return the tallies of a completed event
+    Tally take_event(EventId event);
+
+  private:
+    using StoreT = StreamStore<DetectorParamsData, DetectorStateData>;
+
+    ActionId id_;
+    std::vector<VolumeId> volumes_;
+    HitCallback callback_;
+    mutable StoreT store_;
+
+    // Host event tallies for each stream
+    struct StreamTally
+    {
+        std::mutex lock;  //!< Guards against readers on other threads
+        std::map<EventId, Tally> events;
+        std::vector<DetectorHit> hits;  //!< Host copy of device hits
+    };
+    mutable std::vector<StreamTally> streams_;
+
+    //// HELPER METHODS ////
+
+    template<MemSpace M>
+    DetectorStateData<Ownership::reference, M>&
+    reset_hits(StreamId, size_type) const;
+
+    void accumulate(StreamId, MemSpace) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/detail/DetectorExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/optical/CoreTrackView.hh"
+#include "celeritas/optical/DetectorData.hh"
+#include "celeritas/optical/ParticleTrackView.hh"
+#include "celeritas/optical/SimTrackView.hh"
+#include "celeritas/optical/detail/OpticalUtils.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the arrival-time bin of a hit.
+ *
+ * Photons arriving at or after \c time_max return \c num_time_bins .
+ */
+template<MemSpace M>
+inline CELER_FUNCTION size_type
+find_time_bin(DetectorParamsData<Ownership::const_reference, M> const& params,
+              real_type time)
+{
+    CELER_EXPECT(time >= 0);
+    if (time >= params.time_max)
+    {
+        return params.num_time_bins;
+    }
+    real_type const time_scale = params.num_time_bins / params.time_max;
+    return celeritas::min(static_cast<size_type>(time * time_scale),
+                          params.num_time_bins - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record and absorb photons that crossed into a sensor volume.
+ *
+ * This must be applied after the boundary action so that the geometry state
+ * reflects the volume being entered. Hits are appended to the stream's hit
+ * list and added to its run tallies.
+ */
+struct DetectorExecutor
+{
+    NativeCRef<DetectorParamsData> params;
+    NativeRef<DetectorStateData> state;
+
+    inline CELER_FUNCTION void operator()(CoreTrackView const& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void DetectorExecutor::operator()(CoreTrackView const& track)
+{
+    CELER_EXPECT(params && state);
+
+    auto sim = track.sim();
+    CELER_EXPECT(sim.post_step_action() == track.boundary_action());
+    if (sim.status() != TrackStatus::alive)
+    {
+        // Failed to cross the boundary or already absorbed
+        return;
+    }
+
+    auto geo = track.geometry();
+    if (geo.is_outside())
+    {
+        return;
+    }
+
+    DetectorId det = params.detector[geo.volume_id()];
+    if (!det)
+    {
+        // Not a sensor volume
+        return;
+    }
+
+    DetectorHit hit;
+    hit.detector = det;
+    hit.event = sim.event_id();
+    hit.time = sim.time();
+    hit.energy = track.particle().energy();
+    hit.weight = sim.weight();
+
+    // Append to the compacted hits from this step
+    size_type idx = atomic_add(&state.num_hits[ItemId<size_type>{0}],
+                               size_type{1});
+    CELER_ASSERT(idx < state.hits.size());
+    state.hits[TrackSlotId{idx}] = hit;
+
+    // Add to the stream-local run tallies
+    atomic_add(&state.count[det], hit.weight);
+    atomic_add(&state.wavelength[det],
+               hit.weight * energy_to_wavelength(hit.energy));
+    size_type bin = find_time_bin(params, hit.time);
+    if (bin < params.num_time_bins)
+    {
+        atomic_add(&state.time_hist[ItemId<real_type>{
+                       det.unchecked_get() * params.num_time_bins + bin}],
+                   hit.weight);
+    }
+    else
+    {
+        atomic_add(&state.overflow[det], hit.weight);
+    }
+
+    // The sensor absorbs the photon
+    sim.status(TrackStatus::killed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace optical
+}  // namespace celeritas
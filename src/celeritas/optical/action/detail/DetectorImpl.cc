@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/detail/DetectorImpl.cc
+//---------------------------------------------------------------------------//
+#include "DetectorImpl.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "celeritas/optical/detail/OpticalUtils.hh"
+
+#include "DetectorExecutor.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add a single hit to a tally.
+ *
+ * The tally is sized on first use. Photons arriving after the end of the
+ * histogram are added to the overflow count.
+ */
+void accumulate_hit(HostCRef<DetectorParamsData> const& params,
+                    DetectorHit const& hit,
+                    DetectorAction::Tally* tally)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(hit);
+    CELER_EXPECT(hit.detector < params.num_detectors);
+    CELER_EXPECT(hit.time >= 0);
+    CELER_EXPECT(tally);
+
+    if (tally->count.empty())
+    {
+        tally->count.assign(params.num_detectors, 0);
+        tally->wavelength.assign(params.num_detectors, 0);
+        tally->time_hist.assign(params.num_detectors * params.num_time_bins,
+                                0);
+        tally->overflow.assign(params.num_detectors, 0);
+    }
+
+    auto const det = hit.detector.unchecked_get();
+    tally->count[det] += hit.weight;
+    tally->wavelength[det] += hit.weight * energy_to_wavelength(hit.energy);
+
+    auto bin = find_time_bin(params, hit.time);
+    if (bin < params.num_time_bins)
+    {
+        tally->time_hist[det * params.num_time_bins + bin] += hit.weight;
+    }
+    else
+    {
+        tally->overflow[det] += hit.weight;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add one tally to another.
+ *
+ * Empty tallies (with no hits) are skipped.
+ */
+void accumulate_tally(DetectorAction::Tally const& src,
+                      DetectorAction::Tally* dst)
+{
+    CELER_EXPECT(dst);
+
+    if (src.count.empty())
+    {
+        return;
+    }
+    if (dst->count.empty())
+    {
+        *dst = src;
+        return;
+    }
+
+    auto add = [](DetectorAction::VecReal const& from,
+                  DetectorAction::VecReal* to) {
+        CELER_ASSERT(from.size() == to->size());
+        for (auto i : range(from.size()))
+        {
+            (*to)[i] += from[i];
+        }
+    };
+    add(src.count, &dst->count);
+    add(src.wavelength, &dst->wavelength);
+    add(src.time_hist, &dst->time_hist);
+    add(src.overflow, &dst->overflow);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,34 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/action/detail/DetectorImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "celeritas/optical/DetectorData.hh"
+
+#include "../DetectorAction.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Add a single hit to a tally
+void accumulate_hit(HostCRef<DetectorParamsData> const& params,
+                    DetectorHit const& hit,
+                    DetectorAction::Tally* tally);
+
+// Add one tally to another
+void accumulate_tally(DetectorAction::Tally const& src,
+                      DetectorAction::Tally* dst);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace optical
+}  // namespace celeritas
@@ -47,6 +47,15 @@ CELER_FUNCTION void PreStepExecutor::operator()(CoreTrackView const& track)
 
     CELER_ASSERT(sim.status() == TrackStatus::initializing
                  || sim.status() == TrackStatus::alive);
+
+    if (track.material().is_kill_volume())
+    {
+        // Photons in a kill region don't contribute to the detector response
+        sim.status(TrackStatus::killed);
+        sim.reset_step_limit();
+        return;
+    }
+
     sim.status(TrackStatus::alive);
 }
 
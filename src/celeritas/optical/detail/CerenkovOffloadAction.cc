@@ -122,7 +122,8 @@ void CerenkovOffloadAction::pre_generate(CoreParams const& core_params,
                                                           cerenkov_->host_ref(),
                                                           state.store.ref(),
                                                           state.buffer_size}};
-    launch_action(*this, core_params, core_state, execute);
+    // Launch on all threads to clear distributions from inactive slots
+    launch_core(this->label(), core_params, core_state, execute);
 }
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 #include "OffloadGatherAction.hh"
 
 #include <algorithm>
+#include <utility>
 
 #include "corecel/Assert.hh"
 #include "celeritas/global/ActionLauncher.hh"
@@ -15,6 +16,7 @@
 #include "celeritas/global/CoreState.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/optical/MaterialParams.hh"
 
 #include "OffloadGatherExecutor.hh"
 #include "OffloadParams.hh"
@@ -25,13 +27,16 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with action ID, optical properties, and storage.
+ * Construct with action ID, storage, and optical materials.
  */
-OffloadGatherAction::OffloadGatherAction(ActionId id, AuxId data_id)
-    : id_(id), data_id_(data_id)
+OffloadGatherAction::OffloadGatherAction(ActionId id,
+                                         AuxId data_id,
+                                         SPConstMaterial material)
+    : id_(id), data_id_(data_id), material_(std::move(material))
 {
     CELER_EXPECT(id_);
     CELER_EXPECT(data_id_);
+    CELER_EXPECT(material_);
 }
 
 //---------------------------------------------------------------------------//
@@ -56,7 +61,8 @@ void OffloadGatherAction::step(CoreParams const& params,
     auto execute = make_active_track_executor(
         params.ptr<MemSpace::native>(),
         state.ptr(),
-        detail::OffloadGatherExecutor{optical_state.store.ref()});
+        detail::OffloadGatherExecutor{material_->host_ref(),
+                                      optical_state.store.ref()});
     launch_action(*this, params, state, execute);
 }
 
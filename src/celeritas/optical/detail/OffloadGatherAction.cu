@@ -12,6 +12,7 @@
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
 #include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/optical/MaterialParams.hh"
 
 #include "OffloadGatherExecutor.hh"
 #include "OffloadParams.hh"
@@ -32,7 +33,8 @@ void OffloadGatherAction::step(CoreParams const& params,
     auto execute = make_active_track_executor(
         params.ptr<MemSpace::native>(),
         state.ptr(),
-        detail::OffloadGatherExecutor{optical_state.store.ref()});
+        detail::OffloadGatherExecutor{material_->device_ref(),
+                                      optical_state.store.ref()});
     static ActionLauncher<decltype(execute)> const launch_kernel(*this);
     launch_kernel(state, execute);
 }
@@ -17,6 +17,11 @@
 
 namespace celeritas
 {
+namespace optical
+{
+class MaterialParams;
+}  // namespace optical
+
 namespace detail
 {
 //---------------------------------------------------------------------------//
@@ -25,15 +30,24 @@ namespace detail
  *
  * This pre-step action stores the optical material ID and other
  * beginning-of-step properties so that optical photons can be generated
- * between the start and end points of the step.
+ * between the start and end points of the step. The track weight and the
+ * survival probability of photons in the optical material are also stored so
+ * that generated photons can be thinned and weighted.
  *
  * \sa OffloadGatherExecutor
  */
 class OffloadGatherAction final : public CoreStepActionInterface
 {
   public:
-    // Construct with action ID and storage
-    OffloadGatherAction(ActionId id, AuxId data_id);
+    //!@{
+    //! \name Type aliases
+    using SPConstMaterial
+        = std::shared_ptr<celeritas::optical::MaterialParams const>;
+    //!@}
+
+  public:
+    // Construct with action ID, storage, and optical materials
+    OffloadGatherAction(ActionId id, AuxId data_id, SPConstMaterial material);
 
     // Launch kernel with host data
     void step(CoreParams const&, CoreStateHost&) const final;
@@ -58,6 +72,7 @@ class OffloadGatherAction final : public CoreStepActionInterface
 
     ActionId id_;
     AuxId data_id_;
+    SPConstMaterial material_;
 };
 
 //---------------------------------------------------------------------------//
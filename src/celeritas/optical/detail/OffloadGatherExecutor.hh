@@ -10,6 +10,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/optical/MaterialView.hh"
 #include "celeritas/optical/OffloadData.hh"
 
 namespace celeritas
@@ -30,6 +31,7 @@ struct OffloadGatherExecutor
     inline CELER_FUNCTION void
     operator()(celeritas::CoreTrackView const& track);
 
+    NativeCRef<celeritas::optical::MaterialParamsData> const material;
     NativeRef<OffloadStateData> const state;
 };
 
@@ -41,15 +43,24 @@ struct OffloadGatherExecutor
 CELER_FUNCTION void
 OffloadGatherExecutor::operator()(CoreTrackView const& track)
 {
+    CELER_EXPECT(material);
     CELER_EXPECT(state);
     CELER_EXPECT(track.track_slot_id() < state.step.size());
 
     OffloadPreStepData& step = state.step[track.track_slot_id()];
+    auto sim = track.make_sim_view();
     step.speed = track.make_particle_view().speed();
     step.pos = track.make_geo_view().pos();
-    step.time = track.make_sim_view().time();
+    step.time = sim.time();
+    step.weight = sim.weight();
+    step.event_id = sim.event_id();
     step.material
         = track.make_material_view().make_material_view().optical_material_id();
+    step.survival_probability
+        = step.material
+              ? optical::MaterialView{material, step.material}
+                    .survival_probability()
+              : real_type{1};
 }
 
 //---------------------------------------------------------------------------//
@@ -34,7 +34,8 @@ std::shared_ptr<OpticalLaunchAction>
 OpticalLaunchAction::make_and_insert(CoreParams const& core,
                                      SPConstMaterial material,
                                      SPOffloadParams offload,
-                                     size_type primary_capacity)
+                                     size_type primary_capacity,
+                                     DetectorInput&& detectors)
 {
     CELER_EXPECT(material);
     CELER_EXPECT(offload);
@@ -45,7 +46,8 @@ OpticalLaunchAction::make_and_insert(CoreParams const& core,
                                                         core,
                                                         std::move(material),
                                                         std::move(offload),
-                                                        primary_capacity);
+                                                        primary_capacity,
+                                                        std::move(detectors));
 
     actions.insert(result);
     aux.insert(result);
@@ -61,7 +63,8 @@ OpticalLaunchAction::OpticalLaunchAction(ActionId action_id,
                                          CoreParams const& core,
                                          SPConstMaterial material,
                                          SPOffloadParams offload,
-                                         size_type primary_capacity)
+                                         size_type primary_capacity,
+                                         DetectorInput&& detectors)
     : action_id_{action_id}
     , aux_id_{data_id}
     , offload_params_{std::move(offload)}
@@ -88,6 +91,15 @@ OpticalLaunchAction::OpticalLaunchAction(ActionId action_id,
     // the main loop; for now just make sure enough track initializers are
     // allocated so that we can initialize them all at the beginning of step
 
+    if (detectors)
+    {
+        // Score photons entering sensors after crossing the boundary
+        ActionRegistry& reg = *optical_params_->action_reg();
+        detectors_ = std::make_shared<optical::DetectorAction>(
+            reg.next_id(), *optical_params_, std::move(detectors));
+        reg.insert(detectors_);
+    }
+
     // TODO: should we initialize this at begin-run so that we can add
     // additional optical actions?
     optical_actions_
@@ -13,6 +13,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/data/AuxInterface.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/optical/action/DetectorAction.hh"
 
 namespace celeritas
 {
@@ -52,6 +53,8 @@ class OpticalLaunchAction : public AuxParamsInterface,
     //! \name Type aliases
     using SPOffloadParams = std::shared_ptr<detail::OffloadParams>;
     using SPConstMaterial = std::shared_ptr<optical::MaterialParams const>;
+    using SPDetectorAction = std::shared_ptr<optical::DetectorAction>;
+    using DetectorInput = optical::DetectorAction::Input;
     //!@}
 
   public:
@@ -60,7 +63,8 @@ class OpticalLaunchAction : public AuxParamsInterface,
     make_and_insert(CoreParams const& core,
                     SPConstMaterial material,
                     SPOffloadParams offload,
-                    size_type primary_capacity);
+                    size_type primary_capacity,
+                    DetectorInput&& detectors);
 
     // Construct with IDs, core for copying params, offload gen data
     OpticalLaunchAction(ActionId id,
@@ -68,7 +72,8 @@ class OpticalLaunchAction : public AuxParamsInterface,
                         CoreParams const& core,
                         SPConstMaterial material,
                         SPOffloadParams offload,
-                        size_type primary_capacity);
+                        size_type primary_capacity,
+                        DetectorInput&& detectors);
 
     //!@{
     //! \name Aux/action metadata interface
@@ -98,6 +103,9 @@ class OpticalLaunchAction : public AuxParamsInterface,
     void step(CoreParams const&, CoreStateDevice&) const final;
     //!@}
 
+    //! Optical sensor scoring action (null if no sensors are defined)
+    SPDetectorAction const& detector_action() const { return detectors_; }
+
     // TODO: local end run to flush initializers??
 
   private:
@@ -111,6 +119,7 @@ class OpticalLaunchAction : public AuxParamsInterface,
     AuxId aux_id_;
     SPOffloadParams offload_params_;
     SPOpticalParams optical_params_;
+    SPDetectorAction detectors_;
     SPActionGroups optical_actions_;
 
     //// HELPERS ////
@@ -146,7 +146,8 @@ void ScintGeneratorAction::generate(CoreParams const& core_params,
                                        optical_state.ptr(),
                                        offload_state.buffer_size,
                                        optical_state.counters()}};
-    launch_action(*this, core_params, core_state, execute);
+    // Launch on all threads since work is shared by thread ID
+    launch_core(this->label(), core_params, core_state, execute);
 }
 
 //---------------------------------------------------------------------------//
@@ -115,7 +115,8 @@ void ScintOffloadAction::pre_generate(CoreParams const& core_params,
         core_state.ptr(),
         detail::ScintOffloadExecutor{
             scintillation_->host_ref(), state.store.ref(), state.buffer_size}};
-    launch_action(*this, core_params, core_state, execute);
+    // Launch on all threads to clear distributions from inactive slots
+    launch_core(this->label(), core_params, core_state, execute);
 }
 
 //---------------------------------------------------------------------------//
@@ -16,19 +16,25 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Store secondary cutoff information.
+ *
+ * The tracking cut is an optional energy below which a track in the material
+ * is killed and its energy deposited locally. Since Celeritas materials
+ * correspond to Geant4 material-cuts couples, this allows the tracking cut to
+ * depend on the geometric region.
  */
 struct ParticleCutoff
 {
     units::MevEnergy energy{};  //!< Converted range value
     real_type range{};  //!< [len]
+    units::MevEnergy tracking{};  //!< Kill tracks below this energy
 };
 
 //---------------------------------------------------------------------------//
 /*!
  * IDs of particles that can be killed post-interaction.
  *
- * The ID will be valid if the \c apply_post_interaction option is enabled and
- * the particle is present in the problem.
+ * The ID will be valid if the \c apply_post_interaction option is enabled or
+ * tracking cuts are present, and the particle is present in the problem.
  */
 struct CutoffIds
 {
@@ -44,7 +50,8 @@ struct CutoffIds
  * Secondary production cuts are stored for every material and for only the
  * particle types to which production cuts apply. Positron production cuts are
  * only used when the post-interaction cutoff is enabled. Proton production
- * cuts are currently unused.
+ * cuts are currently unused. Tracking cuts are stored for the same particle
+ * types, and \c has_tracking_cuts is set if any of them are nonzero.
  *
  * \sa CutoffView
  * \sa CutoffParams
@@ -67,8 +74,9 @@ struct CutoffParamsData
     MaterialId::size_type num_materials;  //!< All materials in the problem
 
     bool apply_post_interaction{false};  //!< Apply cutoff post-interaction
+    bool has_tracking_cuts{false};  //!< Any nonzero tracking cut
     CutoffIds ids;  //!< Secondaries that can be killed post-interaction if
-                    //!< their energy is below the production cut
+                    //!< their energy is below the production or tracking cut
 
     //// MEMBER FUNCTIONS ////
 
@@ -90,6 +98,7 @@ struct CutoffParamsData
         this->num_particles = other.num_particles;
         this->num_materials = other.num_materials;
         this->apply_post_interaction = other.apply_post_interaction;
+        this->has_tracking_cuts = other.has_tracking_cuts;
         this->ids = other.ids;
 
         return *this;
@@ -7,16 +7,21 @@
 //---------------------------------------------------------------------------//
 #include "CutoffParams.hh"
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Logger.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/ImportMaterial.hh"
+#include "celeritas/io/ImportVolume.hh"
 #include "celeritas/mat/MaterialParams.hh"
 
 #include "CutoffData.hh"  // IWYU pragma: associated
@@ -41,22 +46,78 @@ CutoffParams::from_import(ImportData const& data,
     input.particles = std::move(particle_params);
     input.materials = std::move(material_params);
 
+    // Geant4 applies the user limits only to particles with a
+    // G4UserSpecialCuts process
+    std::unordered_set<int> user_cut_pdgs;
+    for (auto const& particle : data.particles)
+    {
+        if (particle.user_special_cuts)
+        {
+            user_cut_pdgs.insert(particle.pdg);
+        }
+    }
+
+    // Get the tracking cut of each physics material from the user limits of
+    // the regions it's used in: a material-cuts couple can be shared by
+    // regions with identical production cuts, so use the lowest threshold
+    std::vector<double> tracking_cuts(data.phys_materials.size(),
+                                      std::numeric_limits<double>::infinity());
+    std::vector<double> max_tracking_cuts(data.phys_materials.size(), 0);
+    for (auto const& volume : data.volumes)
+    {
+        if (!volume || volume.region_id == ImportVolume::unspecified
+            || volume.phys_material_id == ImportVolume::unspecified)
+        {
+            continue;
+        }
+        CELER_ASSERT(volume.region_id < data.regions.size());
+        CELER_ASSERT(volume.phys_material_id < tracking_cuts.size());
+        double region_cut = data.regions[volume.region_id].min_energy;
+        auto& cut = tracking_cuts[volume.phys_material_id];
+        cut = std::min(cut, region_cut);
+        auto& max_cut = max_tracking_cuts[volume.phys_material_id];
+        max_cut = std::max(max_cut, region_cut);
+    }
+    for (auto mat_idx : range(tracking_cuts.size()))
+    {
+        auto& cut = tracking_cuts[mat_idx];
+        if (cut == std::numeric_limits<double>::infinity())
+        {
+            // Physics material is not used by any volume
+            cut = 0;
+        }
+        else if (!user_cut_pdgs.empty() && cut < max_tracking_cuts[mat_idx])
+        {
+            CELER_LOG(warning)
+                << "Physics material " << mat_idx
+                << " is shared by regions with different user-limited "
+                   "minimum energies: using the lowest ("
+                << cut << " MeV instead of " << max_tracking_cuts[mat_idx]
+                << " MeV)";
+        }
+    }
+
     for (auto const& pdg : CutoffParams::pdg_numbers())
     {
+        bool const has_user_cuts = user_cut_pdgs.count(pdg.get());
         CutoffParams::MaterialCutoffs mat_cutoffs;
-        for (auto const& material : data.phys_materials)
+        for (auto mat_idx : range(data.phys_materials.size()))
         {
+            auto const& material = data.phys_materials[mat_idx];
+            units::MevEnergy tracking(has_user_cuts ? tracking_cuts[mat_idx]
+                                                    : 0);
             auto iter = material.pdg_cutoffs.find(pdg.get());
             if (iter != material.pdg_cutoffs.end())
             {
                 // Found assigned cutoff values
                 mat_cutoffs.push_back(
                     {units::MevEnergy(iter->second.energy),
-                     static_cast<real_type>(iter->second.range)});
+                     static_cast<real_type>(iter->second.range),
+                     tracking});
             }
             else
             {
-                mat_cutoffs.push_back({zero_quantity(), 0});
+                mat_cutoffs.push_back({zero_quantity(), 0, tracking});
             }
         }
         input.cutoffs.insert({pdg, mat_cutoffs});
@@ -80,12 +141,6 @@ CutoffParams::CutoffParams(Input const& input)
     HostValue host_data;
     host_data.num_materials = input.materials->size();
     host_data.apply_post_interaction = input.apply_post_interaction;
-    if (input.apply_post_interaction)
-    {
-        host_data.ids.electron = input.particles->find(pdg::electron());
-        host_data.ids.positron = input.particles->find(pdg::positron());
-        host_data.ids.gamma = input.particles->find(pdg::gamma());
-    }
 
     std::vector<ParticleCutoff> cutoffs;
 
@@ -121,6 +176,16 @@ CutoffParams::CutoffParams(Input const& input)
     }
     CELER_ASSERT(current_index <= CutoffParams::pdg_numbers().size());
     host_data.num_particles = current_index;
+    host_data.has_tracking_cuts
+        = std::any_of(cutoffs.begin(), cutoffs.end(), [](ParticleCutoff c) {
+              return c.tracking > zero_quantity();
+          });
+    if (host_data.apply_post_interaction || host_data.has_tracking_cuts)
+    {
+        host_data.ids.electron = input.particles->find(pdg::electron());
+        host_data.ids.positron = input.particles->find(pdg::positron());
+        host_data.ids.gamma = input.particles->find(pdg::gamma());
+    }
     make_builder(&host_data.cutoffs).insert_back(cutoffs.begin(), cutoffs.end());
     make_builder(&host_data.id_to_index)
         .insert_back(id_to_index.begin(), id_to_index.end());
@@ -55,6 +55,16 @@ struct ImportData;
  * threshold. If the \c apply_post_interaction option is enabled, any secondary
  * photon, electron, or positron with energy below the cutoff will be killed
  * (the flag will be ignored for other particle types).
+ *
+ * An optional \em tracking cut for photons, electrons, and positrons can
+ * be given for each material. Tracks below it are killed (depositing their
+ * energy locally) when they enter a volume with that material, when they
+ * slow down below it, or when they are produced as secondaries. Since each
+ * material corresponds to a Geant4 material-cuts couple, this provides
+ * region-dependent tracking cuts: during import they are taken from the
+ * minimum kinetic energy of each region's \c G4UserLimits . As in Geant4,
+ * the cut applies only to particles with a \c G4UserSpecialCuts process. A
+ * couple shared by regions with different limits uses the lowest one.
  */
 class CutoffParams final : public ParamsDataInterface<CutoffParamsData>
 {
@@ -24,6 +24,7 @@ namespace celeritas
  * CutoffView cutoff_view(cutoffs.host_ref(), material_id);
  * cutoff_view.energy(particle_id);
  * cutoff_view.range(particle_id);
+ * cutoff_view.tracking(particle_id);
  * \endcode
  */
 class CutoffView
@@ -47,6 +48,12 @@ class CutoffView
     // Return range cutoff value
     inline CELER_FUNCTION real_type range(ParticleId particle) const;
 
+    // Return the energy below which a track is killed
+    inline CELER_FUNCTION Energy tracking(ParticleId particle) const;
+
+    // Whether any material has a nonzero tracking cut
+    inline CELER_FUNCTION bool has_tracking_cuts() const;
+
     // Whether to kill secondaries below the production cut post-interaction
     inline CELER_FUNCTION bool apply_post_interaction() const;
 
@@ -95,6 +102,32 @@ CELER_FUNCTION real_type CutoffView::range(ParticleId particle) const
     return this->get(particle).range;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the energy below which a track is killed.
+ *
+ * This is zero for particle types without production cuts.
+ */
+CELER_FUNCTION auto CutoffView::tracking(ParticleId particle) const -> Energy
+{
+    CELER_EXPECT(particle < params_.id_to_index.size());
+    if (!params_.has_tracking_cuts
+        || !(params_.id_to_index[particle] < params_.num_particles))
+    {
+        return zero_quantity();
+    }
+    return this->get(particle).tracking;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether any material has a nonzero tracking cut.
+ */
+CELER_FUNCTION bool CutoffView::has_tracking_cuts() const
+{
+    return params_.has_tracking_cuts;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether to kill secondaries below the production cut post-interaction.
@@ -108,16 +141,21 @@ CELER_FUNCTION bool CutoffView::apply_post_interaction() const
 /*!
  * Whether the post-interaction cutoff should be applied to the secondary.
  *
- * This will be true if the \c apply_post_interaction option is enabled and the
- * seccondary is an electron, positron, or gamma with energy below the
- * production cut.
+ * This will be true if the secondary is an electron, positron, or gamma with
+ * energy below the production cut (if the \c apply_post_interaction option is
+ * enabled) or below the tracking cut.
  */
 CELER_FUNCTION bool CutoffView::apply(Secondary const& secondary) const
 {
-    return (secondary.particle_id == params_.ids.gamma
-            || secondary.particle_id == params_.ids.electron
-            || secondary.particle_id == params_.ids.positron)
-           && secondary.energy < this->energy(secondary.particle_id);
+    if (!(secondary.particle_id == params_.ids.gamma
+          || secondary.particle_id == params_.ids.electron
+          || secondary.particle_id == params_.ids.positron))
+    {
+        return false;
+    }
+    ParticleCutoff const cutoff = this->get(secondary.particle_id);
+    return (params_.apply_post_interaction && secondary.energy < cutoff.energy)
+           || secondary.energy < cutoff.tracking;
 }
 
 //---------------------------------------------------------------------------//
@@ -144,15 +144,15 @@ InteractionApplierBaseImpl<F>::operator()(celeritas::CoreTrackView const& track)
 
     real_type deposition = result.energy_deposition.value();
     auto cutoff = track.make_cutoff_view();
-    if (cutoff.apply_post_interaction())
+    if (cutoff.apply_post_interaction() || cutoff.has_tracking_cuts())
     {
-        // Kill secondaries with energies below the production cut
+        // Kill secondaries with energies below the production or tracking cut
         for (auto& secondary : result.secondaries)
         {
             if (cutoff.apply(secondary))
             {
                 // Secondary is an electron, positron or gamma with energy
-                // below the production cut -- deposit the energy locally
+                // below the cutoff -- deposit the energy locally
                 // and clear the secondary
                 deposition += secondary.energy.value();
                 auto sec_par = track.make_particle_view(secondary.particle_id);
@@ -25,6 +25,7 @@
 #include "corecel/io/Label.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/ActionRegistry.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/AtomicRelaxationData.hh"
@@ -456,7 +457,7 @@ void PhysicsParams::build_xs(Options const& opts,
     auto integral_xs = make_builder(&data->integral_xs);
     auto value_grid_ids = make_builder(&data->value_grid_ids);
     auto build_grid
-        = [insert_grid](UPGridBuilder const& builder) -> ValueGridId {
+        = [&insert_grid](UPGridBuilder const& builder) -> ValueGridId {
         return builder ? builder->build(insert_grid) : ValueGridId{};
     };
 
@@ -512,13 +513,13 @@ void PhysicsParams::build_xs(Options const& opts,
                 energy_max_xs.resize(mats.size());
             }
 
+            // Construct step limit builders for all materials
+            auto all_builders = this->build_step_limits(proc, applic, mats);
+
             // Loop over materials
             for (auto mat_id : range(MaterialId{mats.size()}))
             {
-                applic.material = mat_id;
-
-                // Construct step limit builders
-                auto builders = proc.step_limits(applic);
+                auto const& builders = all_builders[mat_id.get()];
                 CELER_VALIDATE(
                     std::any_of(builders.begin(),
                                 builders.end(),
@@ -631,6 +632,40 @@ void PhysicsParams::build_xs(Options const& opts,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the step limit builders of a process for every material.
+ *
+ * The builders are independent of each other, so when OpenMP is enabled they
+ * are constructed in parallel (the grids themselves are inserted serially by
+ * the caller, so the resulting data does not depend on the number of threads).
+ */
+auto PhysicsParams::build_step_limits(Process const& proc,
+                                      Applicability const& applic,
+                                      MaterialParams const& mats) const
+    -> std::vector<StepLimitBuilders>
+{
+    std::vector<StepLimitBuilders> result(mats.size());
+
+    MultiExceptionHandler capture_exception;
+#if defined(_OPENMP)
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < result.size(); ++i)
+    {
+        CELER_TRY_HANDLE(
+            [&] {
+                Applicability mat_applic = applic;
+                mat_applic.material = MaterialId{i};
+                result[i] = proc.step_limits(mat_applic);
+            }(),
+            capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct model cross section CDFs.
@@ -686,15 +721,8 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 temp_grid_ids[pm_idx].resize(mats.size());
                 if (material.num_elements() > 1)
                 {
-                    auto& grid_ids = temp_grid_ids[pm_idx][mat_id.get()];
-                    grid_ids.resize(material.num_elements());
-
-                    for (auto elcomp_idx : range(material.num_elements()))
-                    {
-                        CELER_ASSERT(builders[elcomp_idx]);
-                        grid_ids[elcomp_idx]
-                            = builders[elcomp_idx]->build(insert_grid);
-                    }
+                    temp_grid_ids[pm_idx][mat_id.get()]
+                        = build_element_cdf(material, builders, insert_grid);
                 }
             }
             ++pm_idx;
@@ -719,39 +747,6 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 continue;
             }
 
-            // Get the xs value for the given element and bin
-            auto get_value = [&](size_type elcomp, size_type bin) -> real_type& {
-                XsGridData& grid = data->value_grids[grid_ids[elcomp]];
-                CELER_ASSERT(bin < grid.value.size());
-                return data->reals[grid.value[bin]];
-            };
-
-            // Get the number of grid points: the energy grids are the
-            // same for each element in the material
-            size_type num_bins = data->value_grids[grid_ids[0]].value.size();
-
-            // Calculate the cross section CDF
-            auto const&& elements = mats.get(MaterialId{mat_idx}).elements();
-            for (auto bin_idx : range(num_bins))
-            {
-                real_type cum_xs{0};
-                for (auto elcomp_idx : range(elements.size()))
-                {
-                    real_type& xs = get_value(elcomp_idx, bin_idx);
-                    cum_xs += xs * elements[elcomp_idx].fraction;
-                    xs = cum_xs;
-                }
-
-                // Normalize
-                if (cum_xs > 0)
-                {
-                    for (auto elcomp_idx : range(elements.size()))
-                    {
-                        real_type& xs = get_value(elcomp_idx, bin_idx);
-                        xs /= cum_xs;
-                    }
-                }
-            }
             // Construct value grid table
             ValueTable temp_table;
             temp_table.grids
@@ -766,5 +761,78 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the element selection CDF grids for a single material.
+ *
+ * The micro cross sections are built in temporary storage and converted to a
+ * CDF before being inserted, since the inserter may share the stored values
+ * between identical grids.
+ */
+auto PhysicsParams::build_element_cdf(MaterialView const& material,
+                                      Model::MicroXsBuilders const& builders,
+                                      ValueGridInserter& insert_grid) const
+    -> std::vector<ValueGridId>
+{
+    CELER_EXPECT(builders.size() == material.num_elements());
+
+    // Build micro xs grids for each element
+    ValueGridInserter::RealCollection temp_reals;
+    ValueGridInserter::XsGridCollection temp_grids;
+    {
+        ValueGridInserter insert_temp(&temp_reals, &temp_grids);
+        for (auto const& b : builders)
+        {
+            CELER_ASSERT(b);
+            b->build(insert_temp);
+        }
+    }
+    CELER_ASSERT(temp_grids.size() == builders.size());
+
+    // Copy the values: the energy grids are the same for each element in the
+    // material
+    auto const&& elements = material.elements();
+    std::vector<std::vector<double>> values(elements.size());
+    for (auto elcomp_idx : range(elements.size()))
+    {
+        auto const& grid = temp_grids[ValueGridId{elcomp_idx}];
+        auto&& xs = temp_reals[grid.value];
+        values[elcomp_idx].assign(xs.begin(), xs.end());
+        CELER_ASSERT(values[elcomp_idx].size() == values.front().size());
+    }
+
+    // Calculate the cross section CDF
+    for (auto bin_idx : range(values.front().size()))
+    {
+        real_type cum_xs{0};
+        for (auto elcomp_idx : range(elements.size()))
+        {
+            double& xs = values[elcomp_idx][bin_idx];
+            cum_xs += static_cast<real_type>(xs) * elements[elcomp_idx].fraction;
+            xs = cum_xs;
+        }
+
+        // Normalize
+        if (cum_xs > 0)
+        {
+            for (auto elcomp_idx : range(elements.size()))
+            {
+                double& xs = values[elcomp_idx][bin_idx];
+                xs = static_cast<real_type>(xs) / cum_xs;
+            }
+        }
+    }
+
+    // Insert the CDF grids
+    std::vector<ValueGridId> result(elements.size());
+    for (auto elcomp_idx : range(elements.size()))
+    {
+        auto const& grid = temp_grids[ValueGridId{elcomp_idx}];
+        result[elcomp_idx] = insert_grid(
+            grid.log_energy, grid.prime_index, make_span(values[elcomp_idx]));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
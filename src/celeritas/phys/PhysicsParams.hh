@@ -31,7 +31,9 @@ namespace celeritas
 class ActionRegistry;
 class AtomicRelaxationParams;
 class MaterialParams;
+class MaterialView;
 class ParticleParams;
+class ValueGridInserter;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -197,6 +199,7 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     using SPAction = std::shared_ptr<StaticConcreteAction>;
     using VecModel = std::vector<std::pair<SPConstModel, ProcessId>>;
     using HostValue = celeritas::HostVal<PhysicsParamsData>;
+    using StepLimitBuilders = Process::StepLimitBuilders;
 
     // Kernels/actions
     SPAction pre_step_action_;
@@ -222,7 +225,15 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     void build_xs(Options const& opts,
                   MaterialParams const& mats,
                   HostValue* data) const;
+    std::vector<StepLimitBuilders>
+    build_step_limits(Process const& proc,
+                      Applicability const& applic,
+                      MaterialParams const& mats) const;
     void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+    std::vector<ValueGridId>
+    build_element_cdf(MaterialView const& material,
+                      Model::MicroXsBuilders const& builders,
+                      ValueGridInserter& insert_grid) const;
 };
 
 //---------------------------------------------------------------------------//
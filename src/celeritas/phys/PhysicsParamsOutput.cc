@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "PhysicsParamsOutput.hh"
 
+#include <set>
 #include <type_traits>
 #include <utility>
 #include <nlohmann/json.hpp>
@@ -108,6 +109,30 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         obj["sizes"] = std::move(sizes);
     }
 
+    // Save storage reused by grids with identical values
+    {
+        auto const& data = physics_->host_ref();
+
+        std::set<std::pair<size_type, size_type>> stored;
+        size_type num_grids{0};
+        size_type num_reals{0};
+        for (auto id : range(ItemId<XsGridData>{data.value_grids.size()}))
+        {
+            auto const& values = data.value_grids[id].value;
+            if (!stored.insert({values.begin()->unchecked_get(), values.size()})
+                     .second)
+            {
+                ++num_grids;
+                num_reals += values.size();
+            }
+        }
+        obj["deduplicated"] = {
+            {"grids", num_grids},
+            {"reals", num_reals},
+            {"bytes", num_reals * sizeof(real_type)},
+        };
+    }
+
     j->obj = std::move(obj);
 }
 
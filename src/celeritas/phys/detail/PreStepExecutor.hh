@@ -33,7 +33,9 @@ namespace detail
  * - Sample the mean free path and calculate the physics step limits.
  *
  * \note This executor applies to *all* tracks, including inactive ones. It
- *   \em must be run on all thread IDs to properly initialize secondaries.
+ *   \em must be run on thread zero to properly initialize secondaries, but
+ *   inactive slots past the active tracks may be skipped when tracks are
+ *   partitioned by status.
  */
 struct PreStepExecutor
 {
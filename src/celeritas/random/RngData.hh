@@ -20,6 +20,15 @@ template<Ownership W, MemSpace M>
 using RngParamsData = CuHipRngParamsData<W, M>;
 template<Ownership W, MemSpace M>
 using RngStateData = CuHipRngStateData<W, M>;
+using RngThreadState = CuHipRngThreadState;
+
+//! Access the RNG state of a single track slot
+template<Ownership W, MemSpace M>
+CELER_FORCEINLINE_FUNCTION RngThreadState&
+get_rng_thread_state(RngStateData<W, M>& state, TrackSlotId tid)
+{
+    return state.rng[tid];
+}
 }  // namespace celeritas
 #elif (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_XORWOW)
 #    include "XorwowRngData.hh"
@@ -29,6 +38,15 @@ template<Ownership W, MemSpace M>
 using RngParamsData = XorwowRngParamsData<W, M>;
 template<Ownership W, MemSpace M>
 using RngStateData = XorwowRngStateData<W, M>;
+using RngThreadState = XorwowState;
+
+//! Access the RNG state of a single track slot
+template<Ownership W, MemSpace M>
+CELER_FORCEINLINE_FUNCTION RngThreadState&
+get_rng_thread_state(RngStateData<W, M>& state, TrackSlotId tid)
+{
+    return state.state[tid];
+}
 }  // namespace celeritas
 #endif
 // IWYU pragma: end_exports
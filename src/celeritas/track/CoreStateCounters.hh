@@ -34,6 +34,11 @@ struct CoreStateCounters
     size_type num_vacancies{0};  //!< Number of empty track slots
     //!@}
 
+    //!@{
+    //! \name Updated when the initializer queue overflows or drains
+    size_type num_spilled{0};  //!< Initializers stored on host
+    //!@}
+
     //!@{
     //! \name Set after tracks are initialized
     size_type num_active{0};  //!< Number of active tracks at start
@@ -19,6 +19,7 @@
 #include "celeritas/global/CoreState.hh"
 #include "celeritas/track/TrackInitParams.hh"
 
+#include "detail/InitializerSpill.hh"
 #include "detail/ProcessPrimariesExecutor.hh"  // IWYU pragma: associated
 
 namespace celeritas
@@ -104,12 +105,11 @@ void ExtendFromPrimariesAction::insert(CoreParams const& params,
                                        CoreStateInterface& state,
                                        Span<Primary const> host_primaries) const
 {
-    size_type num_initializers = state.counters().num_initializers;
     size_type init_capacity = params.init()->capacity();
 
-    CELER_VALIDATE(host_primaries.size() + num_initializers <= init_capacity,
+    // Queued initializers will be moved to host as needed to make room
+    CELER_VALIDATE(host_primaries.size() <= init_capacity,
                    << "insufficient initializer capacity (" << init_capacity
-                   << ") with size (" << num_initializers
                    << ") for primaries (" << host_primaries.size() << ")");
 
     if (auto* s = dynamic_cast<CoreState<MemSpace::host>*>(&state))
@@ -186,7 +186,9 @@ void ExtendFromPrimariesAction::step_impl(CoreParams const& params,
 {
     auto& primaries = get<PrimaryStateData<M>>(state.aux(), aux_id_);
 
-    // Create track initializers from primaries
+    // Create track initializers from primaries, moving the oldest queued
+    // initializers to host if there isn't enough space
+    detail::spill_initializers(state, primaries.count);
     state.counters().num_initializers += primaries.count;
     this->process_primaries(params, state, primaries);
 
@@ -220,10 +222,11 @@ void ExtendFromPrimariesAction::process_primaries(
         state.ptr(),
         state.counters(),
         primaries};
+    size_type const size = primaries.size();
 #if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
 #    pragma omp parallel for
 #endif
-    for (size_type i = 0, size = primaries.size(); i != size; ++i)
+    for (size_type i = 0; i < size; ++i)
     {
         CELER_TRY_HANDLE(execute_thread(ThreadId{i}), capture_exception);
     }
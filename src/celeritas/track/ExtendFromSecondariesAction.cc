@@ -13,6 +13,7 @@
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
 
+#include "detail/InitializerSpill.hh"
 #include "detail/LocateAliveExecutor.hh"  // IWYU pragma: associated
 #include "detail/ProcessSecondariesExecutor.hh"  // IWYU pragma: associated
 #include "detail/TrackInitAlgorithms.hh"  // IWYU pragma: associated
@@ -76,27 +77,18 @@ void ExtendFromSecondariesAction::step_impl(CoreParams const& core_params,
     counters.num_secondaries = detail::exclusive_scan_counts(
         init.secondary_counts, core_state.stream_id());
 
-    /*! \todo If we don't have space for all the secondaries, we will need to
-     * buffer the current track initializers to create room.
-     *
-     * This isn't trivial because we will need to:
-     * - Allocate a new buffer (probably do something like 2x, rounding up to
-     *   nearest power of 2)?
-     * - Update the collection references for track sim
-     * - Update the *copies* of that reference (?) like in track state
-     * - Copy to device to update the on-device refrences (state.ptr)
-     */
+    // If there isn't enough space for all the secondaries, move the oldest
+    // track initializers to host
+    detail::spill_initializers(core_state, counters.num_secondaries);
     counters.num_initializers += counters.num_secondaries;
-    CELER_VALIDATE(counters.num_initializers <= init.initializers.size(),
-                   << "insufficient capacity (" << init.initializers.size()
-                   << ") for track initializers (created "
-                   << counters.num_secondaries
-                   << " new secondaries for a total capacity requirement of "
-                   << counters.num_initializers << ")");
+    CELER_ASSERT(counters.num_initializers <= init.initializers.size());
 
     // Launch a kernel to create track initializers from secondaries
     counters.num_alive = core_state.size() - counters.num_vacancies;
     this->process_secondaries(core_params, core_state);
+
+    // Restore spilled initializers if the queue can't fill all empty slots
+    detail::refill_initializers(core_state);
 }
 
 //---------------------------------------------------------------------------//
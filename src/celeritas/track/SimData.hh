@@ -97,11 +97,12 @@ struct SimTrackInitializer
     TrackId parent_id;  //!< ID of parent that created it
     EventId event_id;  //!< ID of originating event
     real_type time{0};  //!< Time elapsed in lab frame since start of event
+    real_type weight{1};  //!< Statistical weight
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
     {
-        return track_id && event_id;
+        return track_id && event_id && weight > 0;
     }
 };
 
@@ -132,6 +133,7 @@ struct SimStateData
     Items<size_type> num_looping_steps;  //!< Number of steps taken since the
                                          //!< track was flagged as looping
     Items<real_type> time;  //!< Time elapsed in lab frame since start of event
+    Items<real_type> weight;  //!< Statistical weight
 
     Items<TrackStatus> status;
     Items<real_type> step_length;
@@ -144,7 +146,8 @@ struct SimStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return !track_ids.empty() && !parent_ids.empty() && !event_ids.empty()
-               && !num_steps.empty() && !time.empty() && !status.empty()
+               && !num_steps.empty() && !time.empty() && !weight.empty()
+               && !status.empty()
                && !step_length.empty() && !post_step_action.empty()
                && !along_step_action.empty();
     }
@@ -166,6 +169,7 @@ struct SimStateData
         num_steps = other.num_steps;
         num_looping_steps = other.num_looping_steps;
         time = other.time;
+        weight = other.weight;
         status = other.status;
         step_length = other.step_length;
         post_step_action = other.post_step_action;
@@ -194,6 +198,7 @@ void resize(SimStateData<Ownership::value, M>* data,
         resize(&data->num_looping_steps, size);
     }
     resize(&data->time, size);
+    resize(&data->weight, size);
 
     resize(&data->status, size);
     fill(TrackStatus::inactive, &data->status);
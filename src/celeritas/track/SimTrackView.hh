@@ -52,12 +52,19 @@ class SimTrackView
     // Add the time change over the step
     inline CELER_FUNCTION void add_time(real_type delta);
 
+    // Change the statistical weight for variance reduction
+    inline CELER_FUNCTION void weight(real_type);
+
     // Increment the total number of steps
     inline CELER_FUNCTION void increment_num_steps();
 
     // Update the number of steps this track has been looping
     inline CELER_FUNCTION void update_looping(bool);
 
+    // Restore the step counters of a suspended track
+    inline CELER_FUNCTION void restore_num_steps(size_type num_steps,
+                                                 size_type num_looping_steps);
+
     // Whether the looping track should be abandoned
     inline CELER_FUNCTION bool is_looping(ParticleId, Energy);
 
@@ -93,6 +100,9 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Statistical weight of the track
+    inline CELER_FUNCTION real_type weight() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -156,6 +166,7 @@ CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer_t const& other)
         states_.num_looping_steps[track_slot_] = 0;
     }
     states_.time[track_slot_] = other.time;
+    states_.weight[track_slot_] = other.weight;
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.step_length[track_slot_] = {};
     states_.post_step_action[track_slot_] = {};
@@ -173,6 +184,16 @@ CELER_FUNCTION void SimTrackView::add_time(real_type delta)
     states_.time[track_slot_] += delta;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Change the statistical weight for variance reduction.
+ */
+CELER_FUNCTION void SimTrackView::weight(real_type w)
+{
+    CELER_EXPECT(w > 0);
+    states_.weight[track_slot_] = w;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Increment the total number of steps.
@@ -199,6 +220,25 @@ CELER_FUNCTION void SimTrackView::update_looping(bool is_looping)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the step counters of a suspended track.
+ *
+ * This must be called after the track is initialized, which zeros the
+ * counters. The looping step count is ignored if looping tracks are not being
+ * killed.
+ */
+CELER_FUNCTION void
+SimTrackView::restore_num_steps(size_type num_steps,
+                                size_type num_looping_steps)
+{
+    states_.num_steps[track_slot_] = num_steps;
+    if (!states_.num_looping_steps.empty())
+    {
+        states_.num_looping_steps[track_slot_] = num_looping_steps;
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the looping track should be abandoned.
@@ -374,6 +414,18 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Statistical weight of the track.
+ *
+ * This is unity unless the track (or one of its ancestors) was a weighted
+ * primary or underwent variance reduction.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.weight[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
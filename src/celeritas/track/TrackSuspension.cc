@@ -0,0 +1,230 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSuspension.cc
+//---------------------------------------------------------------------------//
+#include "TrackSuspension.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/Copier.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+
+#include "detail/TrackSuspensionImpl.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record a pending track initializer as a track that has not taken a step.
+ */
+SuspendedTrack make_suspended(TrackInitializer const& init)
+{
+    SuspendedTrack result;
+    result.init = init;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take the tracks suspended from another state.
+ *
+ * The other tracks are appended so that they are resumed first, and the
+ * track counters are combined by taking the maximum for each event.
+ */
+void SuspendedTracks::merge(SuspendedTracks&& other)
+{
+    tracks.insert(tracks.end(),
+                  std::make_move_iterator(other.tracks.begin()),
+                  std::make_move_iterator(other.tracks.end()));
+    if (track_counters.size() < other.track_counters.size())
+    {
+        track_counters.resize(other.track_counters.size(), 0);
+    }
+    for (auto i : range(other.track_counters.size()))
+    {
+        track_counters[i]
+            = std::max(track_counters[i], other.track_counters[i]);
+    }
+    other = {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove all tracks and pending initializers from a state.
+ *
+ * This must be called between steps. The state is reset afterward so that it
+ * can be used to transport new tracks. Initializers that have not been
+ * turned into tracks yet (including those spilled to host) are saved first,
+ * so that the tracks in flight are the first to be resumed.
+ *
+ * The RNG state of each track in flight is saved with it, and the slot it
+ * leaves is moved to a new subsequence, so that a resumed track continues its
+ * own random number stream regardless of the slot or stream it is resumed
+ * in. Pending initializers have not used any random numbers and take the RNG
+ * state of the slot they are resumed in, as new tracks do.
+ *
+ * Suspension is currently only implemented for host states.
+ */
+template<MemSpace M>
+SuspendedTracks suspend_tracks(CoreParams const& params, CoreState<M>& state)
+{
+    CELER_EXPECT(!state.warming_up());
+
+    auto& counters = state.counters();
+    auto const& init = state.ref().init;
+
+    SuspendedTracks result;
+
+    // Save initializers spilled to host
+    auto const& spilled = state.spilled_initializers();
+    result.tracks.reserve(spilled.size() + counters.num_initializers
+                          + state.size() - counters.num_vacancies);
+    std::transform(spilled.begin(),
+                   spilled.end(),
+                   std::back_inserter(result.tracks),
+                   make_suspended);
+
+    // Save initializers in the queue
+    if (counters.num_initializers > 0)
+    {
+        std::vector<TrackInitializer> queued(counters.num_initializers);
+        Copier<TrackInitializer, MemSpace::host> copy_to_host{
+            make_span(queued)};
+        auto all_queued
+            = init.initializers[AllItems<TrackInitializer, M>{}];
+        copy_to_host(M, all_queued.subspan(0, queued.size()));
+        std::transform(queued.begin(),
+                       queued.end(),
+                       std::back_inserter(result.tracks),
+                       make_suspended);
+    }
+
+    // Save the tracks in each slot
+    {
+        StateCollection<SuspendedTrack, Ownership::value, M> slots;
+        resize(&slots, state.size());
+        detail::suspend_slots(
+            params, state, detail::SuspendedSlotRef<M>{slots});
+
+        std::vector<SuspendedTrack> host_slots(state.size());
+        copy_to_host(slots, make_span(host_slots));
+        std::copy_if(host_slots.begin(),
+                     host_slots.end(),
+                     std::back_inserter(result.tracks),
+                     [](SuspendedTrack const& t) { return bool(t); });
+    }
+
+    // Save the number of track IDs used by each event
+    result.track_counters.resize(init.track_counters.size());
+    copy_to_host(init.track_counters, make_span(result.track_counters));
+
+    state.reset();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resume as many suspended tracks as there are empty track slots.
+ *
+ * The most recently suspended tracks are initialized directly in the empty
+ * slots and removed from the suspended list. This should be called between
+ * steps; the resumed tracks are transported starting with the next step
+ * alongside any new tracks from the initializer queue.
+ *
+ * \return Number of tracks resumed
+ */
+template<MemSpace M>
+size_type resume_tracks(CoreParams const& params,
+                        CoreState<M>& state,
+                        SuspendedTracks* suspended)
+{
+    CELER_EXPECT(suspended);
+    CELER_EXPECT(!state.warming_up());
+
+    auto const& state_counters = state.ref().init.track_counters;
+    if (!suspended->track_counters.empty())
+    {
+        // Make sure new secondaries get unique track IDs
+        CELER_VALIDATE(
+            suspended->track_counters.size() <= state_counters.size(),
+            << "suspended tracks have more events ("
+            << suspended->track_counters.size()
+            << ") than the state supports (" << state_counters.size() << ")");
+
+        std::vector<TrackId::size_type> counts(state_counters.size());
+        copy_to_host(state_counters, make_span(counts));
+        bool updated{false};
+        for (auto i : range(suspended->track_counters.size()))
+        {
+            if (suspended->track_counters[i] > counts[i])
+            {
+                counts[i] = suspended->track_counters[i];
+                updated = true;
+            }
+        }
+        if (updated)
+        {
+            Copier<TrackId::size_type, M> copy_to_state{
+                state_counters[AllItems<TrackId::size_type, M>{}]};
+            copy_to_state(MemSpace::host, make_span(counts));
+        }
+    }
+
+    auto& counters = state.counters();
+    size_type const num_resumed
+        = std::min<size_type>(suspended->size(), counters.num_vacancies);
+    if (num_resumed == 0)
+    {
+        return 0;
+    }
+
+    // Copy the most recently suspended tracks to the state
+    auto& tracks = suspended->tracks;
+    Collection<SuspendedTrack, Ownership::value, MemSpace::host> host_tracks;
+    make_builder(&host_tracks)
+        .insert_back(tracks.end() - num_resumed, tracks.end());
+    Collection<SuspendedTrack, Ownership::value, M> resumed;
+    resumed = host_tracks;
+    detail::resume_slots(
+        params, state, detail::SuspendedItemCRef<M>{resumed});
+    tracks.erase(tracks.end() - num_resumed, tracks.end());
+
+    counters.num_vacancies -= num_resumed;
+    counters.num_active = state.size() - counters.num_vacancies;
+    return num_resumed;
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template SuspendedTracks
+suspend_tracks(CoreParams const&, CoreState<MemSpace::host>&);
+template SuspendedTracks
+suspend_tracks(CoreParams const&, CoreState<MemSpace::device>&);
+
+template size_type resume_tracks(CoreParams const&,
+                                 CoreState<MemSpace::host>&,
+                                 SuspendedTracks*);
+template size_type resume_tracks(CoreParams const&,
+                                 CoreState<MemSpace::device>&,
+                                 SuspendedTracks*);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSuspension.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Interaction.hh"
+#include "celeritas/random/RngData.hh"
+
+#include "TrackInitData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class CoreParams;
+template<MemSpace M>
+class CoreState;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Track removed from a state before it was completed.
+ *
+ * In addition to the data needed to initialize a new track, this preserves
+ * the step counters (so that looping tracks are still killed after the
+ * configured number of steps) and the multiple scattering range (so that the
+ * step limit continues from the original track's first step in the volume).
+ * Tracks that have been transported also keep their RNG state, so a resumed
+ * track continues its own random number stream in whatever slot it is
+ * resumed in. The number of mean free paths to the next interaction is
+ * resampled when the track is resumed, which is statistically equivalent.
+ *
+ * Tracks that were suspended on a boundary store the volume they entered so
+ * that the geometry state can be reconstructed on the boundary.
+ */
+struct SuspendedTrack
+{
+    TrackInitializer init;
+    size_type num_steps{0};
+    size_type num_looping_steps{0};
+    MscRange msc_range;
+    VolumeId boundary_volume;  //!< Volume entered if on a boundary
+    bool has_rng{false};  //!< Whether the RNG state was saved
+    RngThreadState rng;
+
+    //! True if assigned and valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return static_cast<bool>(init);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Host storage for tracks removed from one or more states.
+ *
+ * The per-event track counters are the number of track IDs used by each event
+ * at the time the tracks were suspended. They are merged into the state the
+ * tracks are resumed in so that the secondaries of resumed tracks get unique
+ * track IDs even if they are resumed on a different stream.
+ */
+struct SuspendedTracks
+{
+    std::vector<SuspendedTrack> tracks;
+    std::vector<TrackId::size_type> track_counters;
+
+    //! Number of suspended tracks
+    size_type size() const { return tracks.size(); }
+
+    //! Whether no tracks are suspended
+    bool empty() const { return tracks.empty(); }
+
+    // Take the tracks suspended from another state
+    void merge(SuspendedTracks&& other);
+};
+
+//---------------------------------------------------------------------------//
+// Remove all tracks and pending initializers from a state
+template<MemSpace M>
+SuspendedTracks suspend_tracks(CoreParams const& params, CoreState<M>& state);
+
+// Resume as many suspended tracks as there are empty track slots
+template<MemSpace M>
+size_type resume_tracks(CoreParams const& params,
+                        CoreState<M>& state,
+                        SuspendedTracks* suspended);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowAction.cc
+//---------------------------------------------------------------------------//
+#include "WeightWindowAction.hh"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/WeightWindowExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<WeightWindowAction>
+WeightWindowAction::make_and_insert(CoreParams const& core, Input const& input)
+{
+    ActionRegistry& actions = *core.action_reg();
+    auto result = std::make_shared<WeightWindowAction>(
+        actions.next_id(), *core.particle(), *core.geometry(), input);
+    actions.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID, particle and geometry data, and options.
+ */
+WeightWindowAction::WeightWindowAction(ActionId id,
+                                       ParticleParams const& particles,
+                                       GeoParams const& geo,
+                                       Input const& input)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(input.lower_weight > 0,
+                   << "invalid weight window lower bound " << input.lower_weight
+                   << " (must be positive)");
+    CELER_VALIDATE(input.upper_weight == 0
+                       || input.upper_weight >= 2 * input.lower_weight,
+                   << "invalid weight window upper bound "
+                   << input.upper_weight
+                   << " (must be zero or at least twice the lower bound)");
+    CELER_VALIDATE(input.max_split > 1,
+                   << "invalid maximum split count " << input.max_split
+                   << " (must be greater than 1)");
+    CELER_VALIDATE(!input.threshold.empty(),
+                   << "no particle types were specified for the weight "
+                      "window");
+
+    HostVal<WeightWindowParamsData> host_data;
+    host_data.lower_weight = input.lower_weight;
+    host_data.upper_weight = input.upper_weight;
+    host_data.max_split = input.max_split;
+
+    // Save energy thresholds for each particle type
+    std::vector<Energy> threshold(particles.size(), zero_quantity());
+    for (auto const& [pdg, energy] : input.threshold)
+    {
+        ParticleId pid = particles.find(pdg);
+        CELER_VALIDATE(pid,
+                       << "particle type with PDG " << pdg.get()
+                       << " for weight window is not defined");
+        CELER_VALIDATE(energy >= zero_quantity(),
+                       << "invalid weight window threshold " << energy.value()
+                       << " for PDG " << pdg.get());
+        threshold[pid.get()] = energy;
+    }
+    make_builder(&host_data.threshold)
+        .insert_back(threshold.begin(), threshold.end());
+
+    // Flag selected volumes
+    if (!input.volumes.empty())
+    {
+        std::vector<char> volumes(geo.num_volumes(), false);
+        for (std::string const& name : input.volumes)
+        {
+            auto vol_ids = geo.find_volumes(name);
+            CELER_VALIDATE(!vol_ids.empty(),
+                           << "no volume named '" << name
+                           << "' for weight window");
+            for (VolumeId vid : vol_ids)
+            {
+                volumes[vid.get()] = true;
+            }
+        }
+        make_builder(&host_data.volumes)
+            .insert_back(volumes.begin(), volumes.end());
+    }
+
+    data_ = CollectionMirror<WeightWindowParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the action on host.
+ */
+void WeightWindowAction::step(CoreParams const& params,
+                              CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(params.ptr<MemSpace::native>(),
+                                              state.ptr(),
+                                              detail::WeightWindowExecutor{
+                                                  this->host_ref()});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void WeightWindowAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view WeightWindowAction::description() const
+{
+    return "roulette or split low-energy tracks outside the weight window";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,35 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowAction.cu
+//---------------------------------------------------------------------------//
+#include "WeightWindowAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/WeightWindowExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the action on device.
+ */
+void WeightWindowAction::step(CoreParams const& params,
+                              CoreStateDevice& state) const
+{
+    auto execute = make_active_track_executor(params.ptr<MemSpace::native>(),
+                                              state.ptr(),
+                                              detail::WeightWindowExecutor{
+                                                  this->device_ref()});
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
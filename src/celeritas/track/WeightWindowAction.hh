@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "celeritas/geo/GeoFwd.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "WeightWindowData.hh"
+#include "WeightWindowOptions.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a weight window to low-energy tracks for variance reduction.
+ *
+ * After the post-step interaction, each alive track whose energy is below the
+ * threshold for its particle type (and which is in one of the selected
+ * volumes, if any are given) is rouletted if its weight is below the window
+ * or split if its weight is above it: see \c WeightWindowOptions and \c
+ * detail::WeightWindowExecutor . Scoring must multiply tallies by the track
+ * weight, which is available through the step collector.
+ *
+ * This action should be created before any step collectors so that the
+ * post-step weights they record include the weight window adjustment, as in
+ * Geant4. Energy deposition should be scored with the pre-step weight.
+ */
+class WeightWindowAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<WeightWindowParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Input = WeightWindowOptions;
+    using Energy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<WeightWindowAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with ID, particle and geometry data, and options
+    WeightWindowAction(ActionId id,
+                       ParticleParams const& particles,
+                       GeoParams const& geo,
+                       Input const& input);
+
+    //!@{
+    //! \name Action interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "weight-window"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name Data interface
+    //! Access data on host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+    //!@}
+
+  private:
+    ActionId id_;
+    CollectionMirror<WeightWindowParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
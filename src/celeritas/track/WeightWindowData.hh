@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Weight window parameters.
+ *
+ * Tracks below the energy threshold for their particle type are rouletted or
+ * split in the flagged volumes, or in all volumes if none are flagged. A zero
+ * threshold disables the window for that particle type, and a zero upper
+ * weight disables splitting.
+ */
+template<Ownership W, MemSpace M>
+struct WeightWindowParamsData
+{
+    //// TYPES ////
+
+    using Energy = units::MevEnergy;
+
+    //// DATA ////
+
+    //! Energy threshold for each particle type
+    Collection<Energy, W, M, ParticleId> threshold;
+    //! Whether to apply the window in each volume (empty for all volumes)
+    Collection<char, W, M, VolumeId> volumes;
+    //! Lower bound of the window and weight of roulette survivors
+    real_type lower_weight{};
+    //! Upper bound of the window (zero if no splitting)
+    real_type upper_weight{};
+    //! Maximum number of tracks created by splitting one track
+    size_type max_split{};
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !threshold.empty() && lower_weight > 0
+               && (upper_weight == 0 || upper_weight >= 2 * lower_weight)
+               && max_split > 1;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WeightWindowParamsData&
+    operator=(WeightWindowParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        threshold = other.threshold;
+        volumes = other.volumes;
+        lower_weight = other.lower_weight;
+        upper_weight = other.upper_weight;
+        max_split = other.max_split;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
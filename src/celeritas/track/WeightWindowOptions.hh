@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowOptions.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/PDGNumber.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Weight window variance reduction options.
+ *
+ * The window applies to tracks of the listed particle types whose energy is
+ * below the type's threshold, in the listed volumes (or everywhere if no
+ * volumes are listed). Volumes are selected by name, including all volumes
+ * that share the name.
+ *
+ * - A track whose weight is below \c lower_weight plays Russian roulette: it
+ *   survives with probability \f$ w / w_\mathrm{lower} \f$ and its weight is
+ *   raised to \c lower_weight. Survivors are therefore never rouletted again.
+ * - If \c upper_weight is nonzero, a track whose weight is above it is split
+ *   into up to \c max_split identical tracks whose weights sum to the
+ *   original weight. The upper weight must be at least twice the lower
+ *   weight so that the split tracks are not immediately rouletted.
+ *
+ * Both are unbiased as long as all tallies are multiplied by the track weight.
+ */
+struct WeightWindowOptions
+{
+    using Energy = units::MevEnergy;
+
+    //! Energy below which the window applies to each particle type
+    std::map<PDGNumber, Energy> threshold;
+    //! Names of volumes in which to apply the window (empty for all)
+    std::vector<std::string> volumes;
+    //! Tracks below this weight are rouletted, survivors get this weight
+    real_type lower_weight{};
+    //! Tracks above this weight are split (zero to disable splitting)
+    real_type upper_weight{};
+    //! Maximum number of tracks a track is split into
+    size_type max_split{8};
+
+    //! Whether the options are valid
+    explicit operator bool() const
+    {
+        return !threshold.empty() && lower_weight > 0
+               && (upper_weight == 0 || upper_weight >= 2 * lower_weight)
+               && max_split > 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
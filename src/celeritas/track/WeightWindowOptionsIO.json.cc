@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowOptionsIO.json.cc
+//---------------------------------------------------------------------------//
+#include "WeightWindowOptionsIO.json.hh"
+
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/JsonUtils.json.hh"
+
+#include "WeightWindowOptions.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+static char const format_str[] = "weight-window";
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read options from JSON.
+ *
+ * The thresholds are an object whose keys are PDG numbers and whose values
+ * are energies in MeV.
+ */
+void from_json(nlohmann::json const& j, WeightWindowOptions& opts)
+{
+    check_format(j, format_str);
+    check_units(j, format_str);
+
+    opts.threshold.clear();
+    for (auto const& item : j.at("threshold").items())
+    {
+        PDGNumber p{std::stoi(item.key())};
+        CELER_VALIDATE(p, << "invalid PDG number " << item.key());
+        opts.threshold[p]
+            = WeightWindowOptions::Energy{item.value().get<real_type>()};
+    }
+    CELER_JSON_LOAD_OPTION(j, opts, volumes);
+    CELER_JSON_LOAD_REQUIRED(j, opts, lower_weight);
+    CELER_JSON_LOAD_OPTION(j, opts, upper_weight);
+    CELER_JSON_LOAD_OPTION(j, opts, max_split);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write options to JSON.
+ */
+void to_json(nlohmann::json& j, WeightWindowOptions const& opts)
+{
+    auto threshold = nlohmann::json::object();
+    for (auto const& [pdg, energy] : opts.threshold)
+    {
+        threshold[std::to_string(pdg.get())] = energy.value();
+    }
+
+    j = nlohmann::json{
+        {"threshold", std::move(threshold)},
+        CELER_JSON_PAIR(opts, volumes),
+        CELER_JSON_PAIR(opts, lower_weight),
+        CELER_JSON_PAIR(opts, upper_weight),
+        CELER_JSON_PAIR(opts, max_split),
+    };
+
+    save_format(j, format_str);
+    save_units(j);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
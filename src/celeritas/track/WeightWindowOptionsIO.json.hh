@@ -0,0 +1,24 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowOptionsIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+namespace celeritas
+{
+struct WeightWindowOptions;
+//---------------------------------------------------------------------------//
+
+// Read options from JSON
+void from_json(nlohmann::json const& j, WeightWindowOptions& opts);
+
+// Write options to JSON
+void to_json(nlohmann::json& j, WeightWindowOptions const& opts);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
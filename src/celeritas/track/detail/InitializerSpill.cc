@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/InitializerSpill.cc
+//---------------------------------------------------------------------------//
+#include "InitializerSpill.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Copier.hh"
+#include "celeritas/global/CoreState.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+using InitializerItems = Collection<TrackInitializer, Ownership::reference, M>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the first \c count initializers in the queue to host.
+ */
+template<MemSpace M>
+std::vector<TrackInitializer>
+copy_queue_to_host(InitializerItems<M> const& initializers, size_type count)
+{
+    std::vector<TrackInitializer> result(count);
+    if (count > 0)
+    {
+        Copier<TrackInitializer, MemSpace::host> copy_to_host{
+            make_span(result)};
+        copy_to_host(M,
+                     initializers[AllItems<TrackInitializer, M>{}].subspan(
+                         0, count));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Overwrite the start of the queue with initializers from host.
+ */
+template<MemSpace M>
+void copy_queue_from_host(Span<TrackInitializer const> src,
+                          InitializerItems<M> const& initializers)
+{
+    if (!src.empty())
+    {
+        Copier<TrackInitializer, M> copy_from_host{
+            initializers[AllItems<TrackInitializer, M>{}].subspan(
+                0, src.size())};
+        copy_from_host(MemSpace::host, src);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the oldest track initializers to host to make room for new ones.
+ *
+ * The initializer queue is a stack: new tracks are initialized from the
+ * back, so the front holds the oldest (typically highest-generation-energy)
+ * initializers. When the new initializers would overflow the queue, enough
+ * initializers are removed from the front and appended to the host spill
+ * vector, and the rest of the queue is shifted down. Since the positions of
+ * the initializers are unchanged relative to the back of the queue, the
+ * parent track slots stored for in-place initialization remain valid.
+ */
+template<MemSpace M>
+void spill_initializers(CoreState<M>& state, size_type num_new)
+{
+    auto& counters = state.counters();
+    auto const& initializers = state.ref().init.initializers;
+    size_type const capacity = initializers.size();
+    if (counters.num_initializers + num_new <= capacity)
+    {
+        return;
+    }
+
+    CELER_VALIDATE(num_new <= capacity,
+                   << "insufficient capacity (" << capacity
+                   << ") for track initializers (created " << num_new
+                   << " new secondaries in a single step)");
+
+    size_type const num_spill
+        = counters.num_initializers + num_new - capacity;
+    auto queued = copy_queue_to_host(initializers, counters.num_initializers);
+
+    auto& spilled = state.spilled_initializers();
+    spilled.insert(spilled.end(), queued.begin(), queued.begin() + num_spill);
+    copy_queue_from_host(make_span(queued).subspan(num_spill), initializers);
+
+    counters.num_initializers -= num_spill;
+    counters.num_spilled = spilled.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move spilled track initializers back into the queue to fill vacancies.
+ *
+ * Only as many initializers as are needed to fill the empty track slots at
+ * the next step are restored, most recently spilled first. They are inserted
+ * at the front of the queue so that the order of the combined stack is
+ * preserved.
+ */
+template<MemSpace M>
+void refill_initializers(CoreState<M>& state)
+{
+    auto& counters = state.counters();
+    auto& spilled = state.spilled_initializers();
+    if (spilled.empty() || counters.num_initializers >= counters.num_vacancies)
+    {
+        return;
+    }
+
+    auto const& initializers = state.ref().init.initializers;
+    size_type const num_refill = std::min<size_type>(
+        spilled.size(), counters.num_vacancies - counters.num_initializers);
+    CELER_ASSERT(counters.num_initializers + num_refill
+                 <= initializers.size());
+
+    auto queued = copy_queue_to_host(initializers, counters.num_initializers);
+    queued.insert(queued.begin(), spilled.end() - num_refill, spilled.end());
+    spilled.erase(spilled.end() - num_refill, spilled.end());
+    copy_queue_from_host(make_span(queued), initializers);
+
+    counters.num_initializers += num_refill;
+    counters.num_spilled = spilled.size();
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template void spill_initializers(CoreState<MemSpace::host>&, size_type);
+template void spill_initializers(CoreState<MemSpace::device>&, size_type);
+template void refill_initializers(CoreState<MemSpace::host>&);
+template void refill_initializers(CoreState<MemSpace::device>&);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/InitializerSpill.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+template<MemSpace M>
+class CoreState;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Move the oldest track initializers to host to make room for new ones
+template<MemSpace M>
+void spill_initializers(CoreState<M>& state, size_type num_new);
+
+// Move spilled track initializers back into the queue to fill vacancies
+template<MemSpace M>
+void refill_initializers(CoreState<M>& state);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
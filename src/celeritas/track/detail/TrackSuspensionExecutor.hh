@@ -0,0 +1,308 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSuspensionExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/geo/GeoMaterialView.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/mat/MaterialTrackView.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+#include "celeritas/phys/PhysicsTrackView.hh"
+#include "celeritas/random/RngData.hh"
+#include "celeritas/random/RngEngine.hh"
+
+#include "Utils.hh"
+#include "../SimTrackView.hh"
+#include "../TrackSuspension.hh"
+
+#if !CELER_DEVICE_COMPILE
+#    include "corecel/io/Logger.hh"
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Save the track in each slot so that it can be resumed later.
+ *
+ * Empty track slots are given an invalid record. Tracks that were initialized
+ * in place of their parent during the last step have not taken a step yet, so
+ * their multiple scattering range is not saved.
+ *
+ * The track's RNG state is saved, and the slot's RNG is reinitialized on a
+ * new subsequence so that the next track in the slot doesn't repeat the
+ * random numbers of the suspended track.
+ */
+struct SuspendTracksExecutor
+{
+    //// TYPES ////
+
+    using ParamsPtr = CRefPtr<CoreParamsData, MemSpace::native>;
+    using StatePtr = RefPtr<CoreStateData, MemSpace::native>;
+    using SuspendedRef = StateCollection<SuspendedTrack,
+                                         Ownership::reference,
+                                         MemSpace::native>;
+
+    //// DATA ////
+
+    ParamsPtr params;
+    StatePtr state;
+    SuspendedRef suspended;
+
+    //// FUNCTIONS ////
+
+    // Save the track in a single slot
+    inline CELER_FUNCTION void operator()(TrackSlotId tid) const;
+
+    CELER_FORCEINLINE_FUNCTION void operator()(ThreadId tid) const
+    {
+        // The grid size should be equal to the state size and no thread/slot
+        // remapping should be performed
+        return (*this)(TrackSlotId{tid.unchecked_get()});
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize suspended tracks in empty track slots.
+ *
+ * Like initializing a track from a primary, the geometry state is
+ * reconstructed from the position. Tracks suspended on a boundary are
+ * initialized a short distance behind it and moved back onto the boundary,
+ * since the geometry can't be initialized on a surface.
+ */
+struct ResumeTracksExecutor
+{
+    //// TYPES ////
+
+    using ParamsPtr = CRefPtr<CoreParamsData, MemSpace::native>;
+    using StatePtr = RefPtr<CoreStateData, MemSpace::native>;
+    using SuspendedCRef = Collection<SuspendedTrack,
+                                     Ownership::const_reference,
+                                     MemSpace::native>;
+
+    //// DATA ////
+
+    ParamsPtr params;
+    StatePtr state;
+    SuspendedCRef suspended;
+    size_type num_vacancies;
+
+    //! Distance behind the boundary to reconstruct the geometry state
+    static CELER_CONSTEXPR_FUNCTION real_type boundary_offset()
+    {
+        return real_type(1e-5) * units::millimeter;
+    }
+
+    //// FUNCTIONS ////
+
+    // Resume a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+    // Initialize the geometry on the boundary the track was suspended on
+    static inline CELER_FUNCTION bool
+    init_on_boundary(GeoTrackView& geo,
+                     GeoTrackInitializer const& init,
+                     VolumeId volume);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Save the track in a single slot.
+ */
+CELER_FUNCTION void SuspendTracksExecutor::operator()(TrackSlotId tid) const
+{
+    CELER_EXPECT(tid < suspended.size());
+
+    SuspendedTrack& result = suspended[tid];
+    CoreTrackView const track{*params, *state, tid};
+    auto const sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+    {
+        result = {};
+        return;
+    }
+
+    auto const geo = track.make_geo_view();
+    auto const particle = track.make_particle_view();
+    result.init.sim.track_id = sim.track_id();
+    result.init.sim.parent_id = sim.parent_id();
+    result.init.sim.event_id = sim.event_id();
+    result.init.sim.time = sim.time();
+    result.init.sim.weight = sim.weight();
+    result.init.geo.pos = geo.pos();
+    result.init.geo.dir = geo.dir();
+    result.boundary_volume = {};
+    if (geo.is_on_boundary())
+    {
+        result.boundary_volume = geo.volume_id();
+    }
+    result.init.particle.particle_id = particle.particle_id();
+    result.init.particle.energy = particle.energy();
+    result.num_steps = sim.num_steps();
+    result.num_looping_steps
+        = state->sim.num_looping_steps.empty() ? 0 : sim.num_looping_steps();
+    result.msc_range = {};
+    if (sim.status() == TrackStatus::alive)
+    {
+        result.msc_range = track.make_physics_view().msc_range();
+    }
+
+    // Save the track's RNG state and move the slot to a new subsequence
+    result.rng = get_rng_thread_state(state->rng, tid);
+    result.has_rng = true;
+    {
+        RngEngine rng = track.make_rng_engine();
+        ull_int subsequence = rng();
+        subsequence = (subsequence << 32) | rng();
+        RngEngine::Initializer_t init;
+        init.seed = params->rng.seed;
+        init.subsequence = subsequence;
+        rng = init;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resume a single track.
+ *
+ * Suspended tracks are taken from the back of the vacancies, as new tracks
+ * are when initializing from the queue.
+ */
+CELER_FUNCTION void ResumeTracksExecutor::operator()(ThreadId tid) const
+{
+    CELER_EXPECT(tid < suspended.size());
+    CELER_EXPECT(suspended.size() <= num_vacancies);
+
+    SuspendedTrack const& resumed
+        = suspended[ItemId<SuspendedTrack>(tid.unchecked_get())];
+    CoreTrackView vacancy{
+        *params,
+        *state,
+        state->init.vacancies[TrackSlotId(index_before(num_vacancies, tid))]};
+
+    // Initialize the simulation state and particle attributes
+    {
+        auto sim = vacancy.make_sim_view();
+        sim = resumed.init.sim;
+        sim.restore_num_steps(resumed.num_steps, resumed.num_looping_steps);
+    }
+    vacancy.make_particle_view() = resumed.init.particle;
+
+    // Continue the track's random number stream
+    if (resumed.has_rng)
+    {
+        get_rng_thread_state(state->rng, vacancy.track_slot_id())
+            = resumed.rng;
+    }
+
+    // Initialize the geometry from the position
+    {
+        auto geo = vacancy.make_geo_view();
+        if (resumed.boundary_volume
+            && CELER_UNLIKELY(!init_on_boundary(
+                geo, resumed.init.geo, resumed.boundary_volume)))
+        {
+            // Fall back to a point just inside the new volume
+#if !CELER_DEVICE_COMPILE
+            CELER_LOG_LOCAL(warning)
+                << "Failed to reconstruct the boundary state of a resumed "
+                   "track: moving it "
+                << this->boundary_offset() << " into the next volume";
+#endif
+            GeoTrackInitializer bumped = resumed.init.geo;
+            axpy(this->boundary_offset(), bumped.dir, &bumped.pos);
+            geo = bumped;
+        }
+        else if (!resumed.boundary_volume)
+        {
+            geo = resumed.init.geo;
+        }
+        if (CELER_UNLIKELY(geo.failed() || geo.is_outside()))
+        {
+#if !CELER_DEVICE_COMPILE
+            if (!geo.failed())
+            {
+                CELER_LOG_LOCAL(error) << "Resumed track is outside the "
+                                          "geometry";
+            }
+#endif
+            vacancy.apply_errored();
+            return;
+        }
+
+        // Initialize the material
+        auto matid
+            = vacancy.make_geo_material_view().material_id(geo.volume_id());
+        if (CELER_UNLIKELY(!matid))
+        {
+#if !CELER_DEVICE_COMPILE
+            CELER_LOG_LOCAL(error) << "Resumed track is in an unknown "
+                                      "material";
+#endif
+            vacancy.apply_errored();
+            return;
+        }
+        vacancy.make_material_view() = {matid};
+    }
+
+    // Initialize the physics state and restore the MSC step limit data
+    vacancy.make_physics_view() = {};
+    if (resumed.msc_range)
+    {
+        vacancy.make_physics_view().msc_range(resumed.msc_range);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the geometry on the boundary the track was suspended on.
+ *
+ * The state is initialized a short distance behind the boundary and moved
+ * forward across it.
+ *
+ * \return Whether the track is on the boundary of the expected volume
+ */
+CELER_FUNCTION bool
+ResumeTracksExecutor::init_on_boundary(GeoTrackView& geo,
+                                       GeoTrackInitializer const& init,
+                                       VolumeId volume)
+{
+    GeoTrackInitializer behind = init;
+    axpy(-boundary_offset(), behind.dir, &behind.pos);
+    geo = behind;
+    if (geo.failed() || geo.is_outside())
+    {
+        return false;
+    }
+
+    Propagation prop = geo.find_next_step(2 * boundary_offset());
+    if (!prop.boundary)
+    {
+        return false;
+    }
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    return !geo.failed() && !geo.is_outside() && geo.volume_id() == volume;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
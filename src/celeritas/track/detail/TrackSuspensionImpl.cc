@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSuspensionImpl.cc
+//---------------------------------------------------------------------------//
+#include "TrackSuspensionImpl.hh"
+
+#include "corecel/Config.hh"
+
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/global/CoreParams.hh"
+
+#include "TrackSuspensionExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<class F>
+void launch_host(F const& execute_thread, size_type num_threads)
+{
+    MultiExceptionHandler capture_exception;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (ThreadId::size_type i = 0; i < num_threads; ++i)
+    {
+        CELER_TRY_HANDLE(execute_thread(ThreadId{i}), capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the track in every slot on host.
+ */
+void suspend_slots(CoreParams const& params,
+                   CoreState<MemSpace::host>& state,
+                   SuspendedSlotRef<MemSpace::host> const& suspended)
+{
+    CELER_EXPECT(suspended.size() == state.size());
+    SuspendTracksExecutor execute_thread{
+        params.ptr<MemSpace::native>(), state.ptr(), suspended};
+    launch_host(execute_thread, state.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize suspended tracks in the last empty slots on host.
+ */
+void resume_slots(CoreParams const& params,
+                  CoreState<MemSpace::host>& state,
+                  SuspendedItemCRef<MemSpace::host> const& suspended)
+{
+    CELER_EXPECT(suspended.size() <= state.counters().num_vacancies);
+    ResumeTracksExecutor execute_thread{params.ptr<MemSpace::native>(),
+                                        state.ptr(),
+                                        suspended,
+                                        state.counters().num_vacancies};
+    launch_host(execute_thread, suspended.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
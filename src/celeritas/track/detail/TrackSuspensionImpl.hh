@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSuspensionImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/global/CoreState.hh"
+
+#include "../TrackSuspension.hh"
+
+namespace celeritas
+{
+class CoreParams;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+using SuspendedSlotRef
+    = StateCollection<SuspendedTrack, Ownership::reference, M>;
+template<MemSpace M>
+using SuspendedItemCRef
+    = Collection<SuspendedTrack, Ownership::const_reference, M>;
+
+//---------------------------------------------------------------------------//
+// Save the track in every slot
+void suspend_slots(CoreParams const&,
+                   CoreState<MemSpace::host>&,
+                   SuspendedSlotRef<MemSpace::host> const&);
+
+//---------------------------------------------------------------------------//
+// Initialize suspended tracks in the last empty slots
+void resume_slots(CoreParams const&,
+                  CoreState<MemSpace::host>&,
+                  SuspendedItemCRef<MemSpace::host> const&);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+//! \todo Launch the executors on device once the kernels have been tested
+inline void suspend_slots(CoreParams const&,
+                          CoreState<MemSpace::device>&,
+                          SuspendedSlotRef<MemSpace::device> const&)
+{
+    CELER_NOT_IMPLEMENTED("suspending tracks on device");
+}
+
+inline void resume_slots(CoreParams const&,
+                         CoreState<MemSpace::device>&,
+                         SuspendedItemCRef<MemSpace::device> const&)
+{
+    CELER_NOT_IMPLEMENTED("resuming tracks on device");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,135 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/WeightWindowExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/Secondary.hh"
+#include "celeritas/random/distribution/BernoulliDistribution.hh"
+
+#include "../WeightWindowData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Roulette or split tracks whose weight is outside the window.
+ *
+ * A rouletted track survives with probability \f$ w / w_\mathrm{lower} \f$,
+ * and a survivor's weight is raised to the lower bound, so it stays inside
+ * the window on later steps. The secondaries it produced this step inherit
+ * the new weight. A track that loses is killed \em without depositing its
+ * energy, and the secondaries it produced this step are discarded along with
+ * it: since the whole family is rouletted together, the expected weighted
+ * energy of every descendant is unchanged.
+ *
+ * A split track is copied into new secondaries with the same particle type,
+ * energy, direction, and position, and the weight is divided evenly among
+ * the copies and the original. Splitting is deferred if the track is on a
+ * boundary (where secondaries can't be created) or produced secondaries
+ * this step (which must keep the parent's weight); it is skipped if the
+ * secondary stack is full. Declining to split is always unbiased.
+ */
+struct WeightWindowExecutor
+{
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+
+    NativeCRef<WeightWindowParamsData> const params;
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+WeightWindowExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    CELER_EXPECT(params);
+
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive)
+    {
+        // Track was killed or has an error
+        return;
+    }
+
+    auto particle = track.make_particle_view();
+    CELER_ASSERT(particle.particle_id() < params.threshold.size());
+    if (!(particle.energy() < params.threshold[particle.particle_id()]))
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (!params.volumes.empty())
+    {
+        if (geo.is_outside() || !params.volumes[geo.volume_id()])
+        {
+            return;
+        }
+    }
+
+    real_type const weight = sim.weight();
+    if (weight < params.lower_weight)
+    {
+        auto rng = track.make_rng_engine();
+        if (BernoulliDistribution(weight / params.lower_weight)(rng))
+        {
+            // Survived: raise the weight to the window
+            sim.weight(params.lower_weight);
+        }
+        else
+        {
+            // Lost: discard the track and this step's secondaries
+            track.make_physics_step_view().secondaries({});
+            sim.status(TrackStatus::killed);
+        }
+        return;
+    }
+
+    if (params.upper_weight == 0 || !(weight > params.upper_weight)
+        || geo.is_on_boundary())
+    {
+        return;
+    }
+    auto phys_step = track.make_physics_step_view();
+    if (!phys_step.secondaries().empty())
+    {
+        return;
+    }
+
+    // Split into enough tracks to bring the weight inside the window
+    size_type const num_split = celeritas::min(
+        static_cast<size_type>(std::ceil(weight / params.upper_weight)),
+        params.max_split);
+    CELER_ASSERT(num_split > 1);
+    auto allocate_secondaries = phys_step.make_secondary_allocator();
+    Secondary* copies = allocate_secondaries(num_split - 1);
+    if (!copies)
+    {
+        // Secondary stack is full: leave the track intact
+        return;
+    }
+    for (auto i : range(num_split - 1))
+    {
+        copies[i].particle_id = particle.particle_id();
+        copies[i].energy = particle.energy();
+        copies[i].direction = geo.dir();
+    }
+    phys_step.secondaries({copies, num_split - 1});
+    sim.weight(weight / num_split);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
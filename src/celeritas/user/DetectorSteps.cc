@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "DetectorSteps.hh"
 
+#include <vector>
+
 #include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
@@ -67,6 +69,26 @@ void assign_field(DetectorStepOutput::vector<T>* dst,
     CELER_ASSERT(iter == dst->end());
 }
 
+//---------------------------------------------------------------------------//
+template<class T>
+void select_field(DetectorStepOutput::vector<T>* dst,
+                  DetectorStepOutput::vector<T> const& src,
+                  std::vector<size_type> const& indices)
+{
+    dst->clear();
+    if (src.empty())
+    {
+        // This attribute is not in use
+        return;
+    }
+
+    dst->reserve(indices.size());
+    for (size_type i : indices)
+    {
+        dst->push_back(src[i]);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -94,6 +116,7 @@ void copy_steps<MemSpace::host>(
     for (auto sp : range(StepPoint::size_))
     {
         DS_ASSIGN(points[sp].time);
+        DS_ASSIGN(points[sp].weight);
         DS_ASSIGN(points[sp].pos);
         DS_ASSIGN(points[sp].dir);
         DS_ASSIGN(points[sp].energy);
@@ -111,5 +134,56 @@ void copy_steps<MemSpace::host>(
     CELER_ENSURE(output->track_id.size() == size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the steps from a single event to the output.
+ *
+ * This requires that the event ID was selected when gathering the steps, and
+ * is used to separate hits from a stream that transports several events at
+ * once.
+ */
+void select_steps(DetectorStepOutput* output,
+                  DetectorStepOutput const& steps,
+                  EventId event)
+{
+    CELER_EXPECT(output && output != &steps);
+    CELER_EXPECT(event);
+    CELER_EXPECT(steps.event_id.size() == steps.size());
+
+    // Find the steps that belong to the event
+    std::vector<size_type> indices;
+    for (auto i : range(steps.size()))
+    {
+        if (steps.event_id[i] == event)
+        {
+            indices.push_back(i);
+        }
+    }
+
+#define DS_SELECT(FIELD) select_field(&(output->FIELD), steps.FIELD, indices)
+
+    DS_SELECT(detector);
+    DS_SELECT(track_id);
+
+    for (auto sp : range(StepPoint::size_))
+    {
+        DS_SELECT(points[sp].time);
+        DS_SELECT(points[sp].weight);
+        DS_SELECT(points[sp].pos);
+        DS_SELECT(points[sp].dir);
+        DS_SELECT(points[sp].energy);
+    }
+
+    DS_SELECT(event_id);
+    DS_SELECT(parent_id);
+    DS_SELECT(track_step_count);
+    DS_SELECT(step_length);
+    DS_SELECT(particle);
+    DS_SELECT(energy_deposition);
+#undef DS_SELECT
+
+    CELER_ENSURE(output->size() == indices.size());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -66,6 +66,7 @@ gather_step_kernel(DeviceRef<StepStateData> const state, size_type num_valid)
     for (auto sp : range(StepPoint::size_))
     {
         DS_COPY_IF_SELECTED(points[sp].time);
+        DS_COPY_IF_SELECTED(points[sp].weight);
         DS_COPY_IF_SELECTED(points[sp].pos);
         DS_COPY_IF_SELECTED(points[sp].dir);
         DS_COPY_IF_SELECTED(points[sp].energy);
@@ -177,6 +178,7 @@ void copy_steps<MemSpace::device>(
     for (auto sp : range(StepPoint::size_))
     {
         DS_ASSIGN(points[sp].time);
+        DS_ASSIGN(points[sp].weight);
         DS_ASSIGN(points[sp].pos);
         DS_ASSIGN(points[sp].dir);
         DS_ASSIGN(points[sp].energy);
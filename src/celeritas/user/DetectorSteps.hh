@@ -36,6 +36,7 @@ struct DetectorStepPointOutput
     using vector = std::vector<T, PinnedAllocator<T>>;
 
     vector<real_type> time;
+    vector<real_type> weight;
     vector<Real3> pos;
     vector<Real3> dir;
     vector<Energy> energy;
@@ -96,6 +97,11 @@ void copy_steps<MemSpace::device>(
     DetectorStepOutput*,
     StepStateData<Ownership::reference, MemSpace::device> const&);
 
+// Copy the steps from a single event to the output
+void select_steps(DetectorStepOutput* output,
+                  DetectorStepOutput const& steps,
+                  EventId event);
+
 //---------------------------------------------------------------------------//
 #if !CELER_USE_DEVICE
 template<>
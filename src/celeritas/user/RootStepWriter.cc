@@ -175,6 +175,7 @@ void RootStepWriter::process_steps(HostStepState state)
             RSW_STORE(points[sp].volume_id, .unchecked_get());
             RSW_STORE(points[sp].energy, .value());
             RSW_STORE(points[sp].time, /* no getter */);
+            RSW_STORE(points[sp].weight, /* no getter */);
             RSW_STORE(points[sp].dir, /* no getter */);
             RSW_STORE(points[sp].pos, /* no getter */);
         }
@@ -226,12 +227,14 @@ void RootStepWriter::make_tree()
     RSW_CREATE_BRANCH(points[StepPoint::pre].pos, "pre_pos");
     RSW_CREATE_BRANCH(points[StepPoint::pre].energy, "pre_energy");
     RSW_CREATE_BRANCH(points[StepPoint::pre].time, "pre_time");
+    RSW_CREATE_BRANCH(points[StepPoint::pre].weight, "pre_weight");
     // Post-step
     RSW_CREATE_BRANCH(points[StepPoint::post].volume_id, "post_volume_id");
     RSW_CREATE_BRANCH(points[StepPoint::post].dir, "post_dir");
     RSW_CREATE_BRANCH(points[StepPoint::post].pos, "post_pos");
     RSW_CREATE_BRANCH(points[StepPoint::post].energy, "post_energy");
     RSW_CREATE_BRANCH(points[StepPoint::post].time, "post_time");
+    RSW_CREATE_BRANCH(points[StepPoint::post].weight, "post_weight");
 
 #undef RSW_CREATE_BRANCH
 }
@@ -67,6 +67,7 @@ class RootStepWriter final : public StepInterface
         size_type volume_id = unspecified;
         real_type energy = 0;  //!< [MeV]
         real_type time = 0;  //!< [time]
+        real_type weight = 1;
         std::array<real_type, 3> pos{0, 0, 0};  //!< [len]
         std::array<real_type, 3> dir{0, 0, 0};
     };
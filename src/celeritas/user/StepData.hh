@@ -34,17 +34,18 @@ struct StepPointSelection
     bool dir{false};
     bool volume_id{false};
     bool energy{false};
+    bool weight{false};
 
     //! Create StepPointSelection with all options set to true
     static constexpr StepPointSelection all()
     {
-        return StepPointSelection{true, true, true, true, true};
+        return StepPointSelection{true, true, true, true, true, true};
     }
 
     //! Whether any selection is requested
     explicit CELER_FUNCTION operator bool() const
     {
-        return time || pos || dir || volume_id || energy;
+        return time || pos || dir || volume_id || energy || weight;
     }
 
     //! Combine the selection with another
@@ -55,6 +56,7 @@ struct StepPointSelection
         this->dir |= other.dir;
         this->volume_id |= other.volume_id;
         this->energy |= other.energy;
+        this->weight |= other.weight;
         return *this;
     }
 };
@@ -181,6 +183,7 @@ struct StepPointStateData
 
     // Sim
     StateItems<real_type> time;
+    StateItems<real_type> weight;
 
     // Geo
     StateItems<Real3> pos;
@@ -201,6 +204,7 @@ struct StepPointStateData
     {
         CELER_EXPECT(other);
         time = other.time;
+        weight = other.weight;
         pos = other.pos;
         dir = other.dir;
         volume_id = other.volume_id;
@@ -385,6 +389,7 @@ inline void resize(StepPointStateData<Ownership::value, M>* state,
     } while (0)
 
     SD_RESIZE_IF_SELECTED(time);
+    SD_RESIZE_IF_SELECTED(weight);
     SD_RESIZE_IF_SELECTED(pos);
     SD_RESIZE_IF_SELECTED(dir);
     SD_RESIZE_IF_SELECTED(volume_id);
@@ -62,7 +62,8 @@ void StepGatherAction<P>::step(CoreParams const& params,
         state.ptr(),
         detail::StepGatherExecutor<P>{storage_->obj.params<MemSpace::native>(),
                                       step_state}};
-    launch_action(*this, params, state, execute);
+    // Launch on all threads to clear output from inactive slots
+    launch_core(this->label(), params, state, execute);
 
     if (P == StepPoint::post)
     {
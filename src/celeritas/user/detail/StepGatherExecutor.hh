@@ -114,6 +114,7 @@ StepGatherExecutor<P>::operator()(celeritas::CoreTrackView const& track)
         auto const sim = track.make_sim_view();
 
         SGL_SET_IF_SELECTED(points[P].time, sim.time());
+        SGL_SET_IF_SELECTED(points[P].weight, sim.weight());
         if (P == StepPoint::post)
         {
             SGL_SET_IF_SELECTED(event_id, sim.event_id());
@@ -105,7 +105,7 @@ namespace detail
  */
 void MultiExceptionHandler::operator()(std::exception_ptr p)
 {
-#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#if defined(_OPENMP)
 #    pragma omp critical(MultiExceptionHandler)
 #endif
     {
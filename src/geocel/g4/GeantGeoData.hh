@@ -66,6 +66,7 @@ struct GeantGeoStateData
     Items<Real3> dir;
     Items<real_type> next_step;
     Items<real_type> safety_radius;
+    Items<Real3> safety_pos;
 
     // Wrapper for G4TouchableHistory and G4Navigator
     detail::GeantGeoNavCollection<W, M> nav_state;
@@ -78,6 +79,7 @@ struct GeantGeoStateData
         return this->size() > 0 && dir.size() == this->size()
                && next_step.size() == this->size()
                && safety_radius.size() == this->size()
+               && safety_pos.size() == this->size()
                && nav_state.size() == this->size();
     }
 
@@ -96,6 +98,7 @@ struct GeantGeoStateData
         dir = other.dir;
         next_step = other.next_step;
         safety_radius = other.safety_radius;
+        safety_pos = other.safety_pos;
         nav_state = other.nav_state;
         return *this;
     }
@@ -119,6 +122,7 @@ inline void resize(GeantGeoStateData<Ownership::value, MemSpace::host>* data,
     resize(&data->dir, size);
     resize(&data->next_step, size);
     resize(&data->safety_radius, size);
+    resize(&data->safety_pos, size);
     data->nav_state.resize(size, params.world, stream_id);
 
     CELER_ENSURE(data);
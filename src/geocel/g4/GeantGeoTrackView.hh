@@ -37,6 +37,10 @@ namespace celeritas
  * duplicating the "geant4" position and direction that are also stored under
  * the hood in the heavyweight navigator.
  *
+ * The most recent safety distance and the position where it was calculated
+ * are kept as a "safety sphere" while the track moves inside the volume, so
+ * that repeated safety queries along the way don't call the navigator.
+ *
  * For a description of ordering requirements, see: \sa OrangeTrackView .
  */
 class GeantGeoTrackView
@@ -140,6 +144,7 @@ class GeantGeoTrackView
     Real3& dir_;
     real_type& next_step_;
     real_type& safety_radius_;
+    Real3& safety_pos_;
     G4TouchableHandle& touch_handle_;
     G4Navigator& navi_;
     //!@}
@@ -156,6 +161,9 @@ class GeantGeoTrackView
 
     //! Get a pointer to the current volume; null if outside
     inline G4LogicalVolume const* volume() const;
+
+    // Mark as no longer on a boundary but keep the safety sphere
+    inline void clear_boundary_safety();
 };
 
 //---------------------------------------------------------------------------//
@@ -171,6 +179,7 @@ GeantGeoTrackView::GeantGeoTrackView(ParamsRef const&,
     , dir_(states.dir[tid])
     , next_step_(states.next_step[tid])
     , safety_radius_(states.safety_radius[tid])
+    , safety_pos_(states.safety_pos[tid])
     , touch_handle_(states.nav_state.touch_handle(tid))
     , navi_(states.nav_state.navigator(tid))
 {
@@ -223,6 +232,7 @@ GeantGeoTrackView& GeantGeoTrackView::operator=(DetailedInitializer const& init)
         // Copy values from the parent state
         pos_ = init.other.pos_;
         safety_radius_ = init.other.safety_radius_;
+        safety_pos_ = init.other.safety_pos_;
         g4pos_ = init.other.g4pos_;
         g4dir_ = init.other.g4dir_;
         g4safety_ = init.other.g4safety_;
@@ -315,6 +325,7 @@ Propagation GeantGeoTrackView::find_next_step(real_type max_step)
         // Save the resulting safety distance if computed: allow to be
         // "negative" to prevent accidentally changing the boundary state
         safety_radius_ = convert_from_geant(g4safety_, clhep_length);
+        safety_pos_ = pos_;
         CELER_ASSERT(!this->is_on_boundary());
     }
 
@@ -359,20 +370,30 @@ auto GeantGeoTrackView::find_safety() -> real_type
 /*!
  * Find the safety at the current position.
  *
+ * The navigator is only queried if the track is less than \c max_step from
+ * the surface of the cached safety sphere.
+ *
  * \warning This can change the boundary state if the track was moved to or
  * initialized a point on the boundary.
  */
 auto GeantGeoTrackView::find_safety(real_type max_step) -> real_type
 {
     CELER_EXPECT(max_step > 0);
-    if (!this->is_on_boundary() && (safety_radius_ < max_step))
+    if (this->is_on_boundary())
+    {
+        return 0;
+    }
+
+    real_type safety = safety_radius_ - distance(pos_, safety_pos_);
+    if (safety < max_step)
     {
         real_type g4step = convert_to_geant(max_step, clhep_length);
         g4safety_ = navi_.ComputeSafety(g4pos_, g4step);
         safety_radius_ = max(convert_from_geant(g4safety_, clhep_length), 0.0);
+        safety_pos_ = pos_;
+        safety = safety_radius_;
     }
-
-    return safety_radius_;
+    return safety;
 }
 
 //---------------------------------------------------------------------------//
@@ -431,8 +452,7 @@ void GeantGeoTrackView::move_internal(real_type dist)
     next_step_ -= dist;
     navi_.LocateGlobalPointWithinVolume(g4pos_);
 
-    safety_radius_ = -1;
-    g4safety_ = 0;
+    this->clear_boundary_safety();
 }
 
 //---------------------------------------------------------------------------//
@@ -449,8 +469,7 @@ void GeantGeoTrackView::move_internal(Real3 const& pos)
     next_step_ = 0;
     navi_.LocateGlobalPointWithinVolume(g4pos_);
 
-    safety_radius_ = -1;
-    g4safety_ = 0;
+    this->clear_boundary_safety();
 }
 
 //---------------------------------------------------------------------------//
@@ -493,5 +512,22 @@ auto GeantGeoTrackView::volume() const -> G4LogicalVolume const*
     return pv->GetLogicalVolume();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Mark as no longer on a boundary after moving inside the volume.
+ *
+ * A zero safety radius flags the track as being on a boundary, so it is
+ * invalidated. A positive safety radius is kept: the distance moved from the
+ * sphere origin is accounted for by \c find_safety .
+ */
+void GeantGeoTrackView::clear_boundary_safety()
+{
+    if (safety_radius_ <= 0)
+    {
+        safety_radius_ = -1;
+    }
+    g4safety_ = 0;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -74,6 +74,10 @@ struct VecgeomStateData
     Items<Real3> pos;
     Items<Real3> dir;
 
+    // Cached safety sphere: negative radius if invalid
+    Items<Real3> safety_pos;
+    Items<real_type> safety_radius;
+
     // Wrapper for NavStatePool, vector, or void*
     detail::VecgeomNavCollection<W, M> vgstate;
     detail::VecgeomNavCollection<W, M> vgnext;
@@ -83,8 +87,9 @@ struct VecgeomStateData
     //! True if sizes are consistent and states are assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return this->size() > 0 && dir.size() == this->size() && vgstate
-               && vgnext;
+        return this->size() > 0 && dir.size() == this->size()
+               && safety_pos.size() == this->size()
+               && safety_radius.size() == this->size() && vgstate && vgnext;
     }
 
     //! State size
@@ -100,6 +105,8 @@ struct VecgeomStateData
         CELER_EXPECT(other);
         pos = other.pos;
         dir = other.dir;
+        safety_pos = other.safety_pos;
+        safety_radius = other.safety_radius;
         vgstate = other.vgstate;
         vgnext = other.vgnext;
         return *this;
@@ -121,6 +128,8 @@ void resize(VecgeomStateData<Ownership::value, M>* data,
 
     resize(&data->pos, size);
     resize(&data->dir, size);
+    resize(&data->safety_pos, size);
+    resize(&data->safety_radius, size);
     data->vgstate.resize(params.max_depth, size);
     data->vgnext.resize(params.max_depth, size);
 
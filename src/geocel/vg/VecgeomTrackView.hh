@@ -47,7 +47,9 @@ namespace celeritas
    \endcode
  *
  * The "next distance" is cached as part of `find_next_step`, but it is only
- * used when the immediate next call is `move_to_boundary`.
+ * used when the immediate next call is `move_to_boundary`. The last safety
+ * distance and the position where it was calculated are cached across steps
+ * as a "safety sphere" until the track is initialized or moves to a boundary.
  */
 class VecgeomTrackView
 {
@@ -161,6 +163,8 @@ class VecgeomTrackView
     NavState& vgnext_;
     Real3& pos_;
     Real3& dir_;
+    Real3& safety_pos_;
+    real_type& safety_radius_;
     //!@}
 
     // Temporary data
@@ -193,6 +197,8 @@ VecgeomTrackView::VecgeomTrackView(ParamsRef const& params,
     , vgnext_(states.vgnext.at(params_.max_depth, tid))
     , pos_(states.pos[tid])
     , dir_(states.dir[tid])
+    , safety_pos_(states.safety_pos[tid])
+    , safety_radius_(states.safety_radius[tid])
 {
 }
 
@@ -212,6 +218,7 @@ VecgeomTrackView::operator=(Initializer_t const& init)
     // Initialize position/direction
     pos_ = init.pos;
     dir_ = init.dir;
+    safety_radius_ = -1;
 
     // Set up current state and locate daughter volume.
     vgstate_.Clear();
@@ -243,6 +250,8 @@ VecgeomTrackView& VecgeomTrackView::operator=(DetailedInitializer const& init)
         // Copy the navigation state and position from the parent state
         init.other.vgstate_.CopyTo(&vgstate_);
         pos_ = init.other.pos_;
+        safety_pos_ = init.other.safety_pos_;
+        safety_radius_ = init.other.safety_radius_;
     }
 
     // Set up the next state and initialize the direction
@@ -373,7 +382,8 @@ CELER_FUNCTION real_type VecgeomTrackView::find_safety()
  * Find the safety at the current position up to a maximum distance.
  *
  * The safety within a step is only needed up to the end of the physics step
- * length.
+ * length. If the track is still at least that far inside the last calculated
+ * safety sphere, the navigator isn't queried.
  */
 CELER_FUNCTION real_type VecgeomTrackView::find_safety(real_type max_radius)
 {
@@ -381,8 +391,15 @@ CELER_FUNCTION real_type VecgeomTrackView::find_safety(real_type max_radius)
     CELER_EXPECT(!this->is_on_boundary());
     CELER_EXPECT(max_radius > 0);
 
+    if (safety_radius_ - distance(pos_, safety_pos_) >= max_radius)
+    {
+        return max_radius;
+    }
+
     real_type safety
         = Navigator::ComputeSafety(detail::to_vector(this->pos()), vgstate_);
+    safety_pos_ = pos_;
+    safety_radius_ = safety;
     safety = min<real_type>(safety, max_radius);
 
     // Since the reported "safety" is negative if we've moved slightly beyond
@@ -402,6 +419,7 @@ CELER_FUNCTION void VecgeomTrackView::move_to_boundary()
     // Move next step
     axpy(next_step_, dir_, &pos_);
     next_step_ = 0;
+    safety_radius_ = -1;
     vgstate_.SetBoundaryState(true);
 
     CELER_ENSURE(this->is_on_boundary());
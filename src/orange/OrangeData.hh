@@ -465,6 +465,10 @@ struct OrangeStateData
     StateItems<LocalSurfaceId> next_surf;
     StateItems<Sense> next_sense;
 
+    // Cached safety sphere {num_tracks}: negative radius if invalid
+    StateItems<Real3> safety_pos;
+    StateItems<real_type> safety_radius;
+
     // State with dimensions {num_tracks, max_depth}
     Items<Real3> pos;
     Items<Real3> dir;
@@ -495,6 +499,8 @@ struct OrangeStateData
             && next_step.size() == this->size()
             && next_surf.size() == this->size()
             && next_sense.size() == this->size()
+            && safety_pos.size() == this->size()
+            && safety_radius.size() == this->size()
             && pos.size() == max_depth * this->size()
             && dir.size() == max_depth  * this->size()
             && vol.size() == max_depth  * this->size()
@@ -527,6 +533,9 @@ struct OrangeStateData
         next_surf = other.next_surf;
         next_sense = other.next_sense;
 
+        safety_pos = other.safety_pos;
+        safety_radius = other.safety_radius;
+
         pos = other.pos;
         dir = other.dir;
         vol = other.vol;
@@ -568,6 +577,9 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->next_surf, num_tracks);
     resize(&data->next_sense, num_tracks);
 
+    resize(&data->safety_pos, num_tracks);
+    resize(&data->safety_radius, num_tracks);
+
     size_type level_states = params.scalars.max_depth * num_tracks;
     resize(&data->pos, level_states);
     resize(&data->dir, level_states);
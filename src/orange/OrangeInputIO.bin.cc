@@ -0,0 +1,469 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeInputIO.bin.cc
+//---------------------------------------------------------------------------//
+#include "OrangeInputIO.bin.hh"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/StringUtils.hh"
+#include "surf/SurfaceTypeTraits.hh"
+#include "transform/TransformTypeTraits.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// CONSTANTS
+//---------------------------------------------------------------------------//
+
+//! Leading characters of a binary ORANGE file
+constexpr std::array<char, 8> magic{'O', 'R', 'A', 'N', 'G', 'E', 'B', '\0'};
+//! Increment when the layout changes
+constexpr std::uint32_t format_version = 1;
+//! Byte order check
+constexpr std::uint32_t endian_check = 0x01020304;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write plain data and containers to a binary stream.
+ *
+ * All integers are written as fixed-width 32-bit values and reals with the
+ * native precision: the header records the real size and byte order so that
+ * incompatible files are rejected when read.
+ */
+class BinaryWriter
+{
+  public:
+    explicit BinaryWriter(std::ostream& os) : os_{os} {}
+
+    template<class T>
+    void raw(T const& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        os_.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template<class T>
+    void raw_span(T const* data, std::size_t size)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        os_.write(reinterpret_cast<char const*>(data), sizeof(T) * size);
+    }
+
+    void count(std::size_t size)
+    {
+        CELER_VALIDATE(size <= std::size_t(UINT32_MAX),
+                       << "ORANGE binary container size " << size
+                       << " is too large");
+        this->raw(static_cast<std::uint32_t>(size));
+    }
+
+    template<class T>
+    void id(OpaqueId<T> value)
+    {
+        this->raw(static_cast<std::uint32_t>(value.unchecked_get()));
+    }
+
+    void operator()(std::string const& s)
+    {
+        this->count(s.size());
+        this->raw_span(s.data(), s.size());
+    }
+
+    void operator()(Label const& label)
+    {
+        (*this)(label.name);
+        (*this)(label.ext);
+    }
+
+    template<class T>
+    void operator()(std::vector<T> const& values)
+    {
+        this->count(values.size());
+        this->raw_span(values.data(), values.size());
+    }
+
+    void operator()(BBox const& bbox)
+    {
+        this->raw(bbox.lower());
+        this->raw(bbox.upper());
+    }
+
+    void operator()(VariantTransform const& transform)
+    {
+        std::visit(
+            [this](auto&& t) {
+                this->raw(t.transform_type());
+                auto data = t.data();
+                this->raw_span(data.data(), data.size());
+            },
+            transform);
+    }
+
+    void operator()(VariantSurface const& surface)
+    {
+        std::visit(
+            [this](auto&& s) {
+                this->raw(s.surface_type());
+                auto data = s.data();
+                this->raw_span(data.data(), data.size());
+            },
+            surface);
+    }
+
+    void operator()(DaughterInput const& daughter)
+    {
+        this->id(daughter.universe_id);
+        (*this)(daughter.transform);
+    }
+
+    void operator()(VolumeInput const& vol)
+    {
+        (*this)(vol.label);
+        (*this)(vol.faces);
+        (*this)(vol.logic);
+        (*this)(vol.bbox);
+        (*this)(vol.obz.inner);
+        (*this)(vol.obz.outer);
+        this->id(vol.obz.transform_id);
+        this->raw(vol.flags);
+        this->raw(vol.zorder);
+    }
+
+    void operator()(UnitInput const& unit)
+    {
+        (*this)(unit.label);
+        this->count(unit.surfaces.size());
+        for (auto const& s : unit.surfaces)
+        {
+            (*this)(s);
+        }
+        this->count(unit.volumes.size());
+        for (auto const& v : unit.volumes)
+        {
+            (*this)(v);
+        }
+        (*this)(unit.bbox);
+        this->count(unit.daughter_map.size());
+        for (auto const& [vol_id, daughter] : unit.daughter_map)
+        {
+            this->id(vol_id);
+            (*this)(daughter);
+        }
+        this->count(unit.surface_labels.size());
+        for (auto const& label : unit.surface_labels)
+        {
+            (*this)(label);
+        }
+    }
+
+    void operator()(RectArrayInput const& arr)
+    {
+        (*this)(arr.label);
+        for (auto const& g : arr.grid)
+        {
+            (*this)(g);
+        }
+        this->count(arr.daughters.size());
+        for (auto const& d : arr.daughters)
+        {
+            (*this)(d);
+        }
+    }
+
+  private:
+    std::ostream& os_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read data written by \c BinaryWriter .
+ */
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(std::istream& is) : is_{is} {}
+
+    template<class T>
+    void raw(T* value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        this->read(reinterpret_cast<char*>(value), sizeof(T));
+    }
+
+    template<class T>
+    void raw_span(T* data, std::size_t size)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        this->read(reinterpret_cast<char*>(data), sizeof(T) * size);
+    }
+
+    std::size_t count()
+    {
+        std::uint32_t result;
+        this->raw(&result);
+        return result;
+    }
+
+    template<class T>
+    void id(OpaqueId<T>* value)
+    {
+        std::uint32_t temp;
+        this->raw(&temp);
+        using size_type = typename OpaqueId<T>::size_type;
+        *value = OpaqueId<T>{static_cast<size_type>(temp)};
+    }
+
+    void operator()(std::string* s)
+    {
+        s->resize(this->count());
+        this->raw_span(s->data(), s->size());
+    }
+
+    void operator()(Label* label)
+    {
+        (*this)(&label->name);
+        (*this)(&label->ext);
+    }
+
+    template<class T>
+    void operator()(std::vector<T>* values)
+    {
+        values->resize(this->count());
+        this->raw_span(values->data(), values->size());
+    }
+
+    void operator()(BBox* bbox)
+    {
+        BBox::Real3 lower;
+        BBox::Real3 upper;
+        this->raw(&lower);
+        this->raw(&upper);
+        *bbox = BBox::from_unchecked(lower, upper);
+    }
+
+    void operator()(VariantTransform* transform)
+    {
+        TransformType tt;
+        this->raw(&tt);
+        CELER_VALIDATE(tt < TransformType::size_,
+                       << "invalid transform type in ORANGE binary input");
+        visit_transform_type(
+            [this, transform](auto tt_constant) {
+                using Transform = typename decltype(tt_constant)::type;
+                using StorageSpan = typename Transform::StorageSpan;
+
+                Array<real_type, StorageSpan::extent + 1> data;
+                this->raw_span(data.data(), StorageSpan::extent);
+                *transform = Transform{
+                    StorageSpan{data.data(), StorageSpan::extent}};
+            },
+            tt);
+    }
+
+    //! Read a surface, which isn't default-constructible, onto a vector
+    void append_surface(std::vector<VariantSurface>* surfaces)
+    {
+        SurfaceType st;
+        this->raw(&st);
+        CELER_VALIDATE(st < SurfaceType::size_,
+                       << "invalid surface type in ORANGE binary input");
+        visit_surface_type(
+            [this, surfaces](auto st_constant) {
+                using Surface = typename decltype(st_constant)::type;
+                using StorageSpan = typename Surface::StorageSpan;
+
+                Array<real_type, StorageSpan::extent> data;
+                this->raw_span(data.data(), data.size());
+                surfaces->emplace_back(std::in_place_type<Surface>,
+                                       StorageSpan{data.data(), data.size()});
+            },
+            st);
+    }
+
+    void operator()(DaughterInput* daughter)
+    {
+        this->id(&daughter->universe_id);
+        (*this)(&daughter->transform);
+    }
+
+    void operator()(VolumeInput* vol)
+    {
+        (*this)(&vol->label);
+        (*this)(&vol->faces);
+        (*this)(&vol->logic);
+        (*this)(&vol->bbox);
+        (*this)(&vol->obz.inner);
+        (*this)(&vol->obz.outer);
+        this->id(&vol->obz.transform_id);
+        this->raw(&vol->flags);
+        this->raw(&vol->zorder);
+    }
+
+    void operator()(UnitInput* unit)
+    {
+        (*this)(&unit->label);
+        auto num_surfaces = this->count();
+        unit->surfaces.reserve(num_surfaces);
+        for (auto i : range(num_surfaces))
+        {
+            CELER_DISCARD(i);
+            this->append_surface(&unit->surfaces);
+        }
+        unit->volumes.resize(this->count());
+        for (auto& v : unit->volumes)
+        {
+            (*this)(&v);
+        }
+        (*this)(&unit->bbox);
+        for (auto i : range(this->count()))
+        {
+            CELER_DISCARD(i);
+            LocalVolumeId vol_id;
+            DaughterInput daughter;
+            this->id(&vol_id);
+            (*this)(&daughter);
+            unit->daughter_map.emplace(vol_id, std::move(daughter));
+        }
+        unit->surface_labels.resize(this->count());
+        for (auto& label : unit->surface_labels)
+        {
+            (*this)(&label);
+        }
+    }
+
+    void operator()(RectArrayInput* arr)
+    {
+        (*this)(&arr->label);
+        for (auto& g : arr->grid)
+        {
+            (*this)(&g);
+        }
+        arr->daughters.resize(this->count());
+        for (auto& d : arr->daughters)
+        {
+            (*this)(&d);
+        }
+    }
+
+  private:
+    std::istream& is_;
+
+    void read(char* data, std::streamsize size)
+    {
+        is_.read(data, size);
+        CELER_VALIDATE(is_.gcount() == size,
+                       << "unexpected end of ORANGE binary input");
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read an ORANGE input definition from a binary stream.
+ *
+ * The stream must be opened in binary mode.
+ */
+void from_binary(std::istream& is, OrangeInput& value)
+{
+    BinaryReader read{is};
+
+    std::array<char, magic.size()> file_magic;
+    read.raw(&file_magic);
+    CELER_VALIDATE(file_magic == magic,
+                   << "input is not an ORANGE binary geometry");
+
+    std::uint32_t version;
+    std::uint32_t endian;
+    std::uint32_t real_size;
+    read.raw(&version);
+    read.raw(&endian);
+    read.raw(&real_size);
+    CELER_VALIDATE(version == format_version,
+                   << "unsupported ORANGE binary format version " << version
+                   << " (expected " << format_version << ")");
+    CELER_VALIDATE(endian == endian_check,
+                   << "ORANGE binary input was written with a different "
+                      "byte order");
+    CELER_VALIDATE(real_size == sizeof(real_type),
+                   << "ORANGE binary input was written with " << real_size
+                   << "-byte reals, but this build uses " << sizeof(real_type)
+                   << "-byte reals");
+
+    read.raw(&value.tol.rel);
+    read.raw(&value.tol.abs);
+
+    value.universes.resize(read.count());
+    for (auto& univ : value.universes)
+    {
+        std::uint32_t index;
+        read.raw(&index);
+        if (index == 0)
+        {
+            read(&univ.emplace<UnitInput>());
+        }
+        else
+        {
+            CELER_VALIDATE(index == 1,
+                           << "invalid universe type " << index
+                           << " in ORANGE binary input");
+            read(&univ.emplace<RectArrayInput>());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write an ORANGE input definition to a binary stream.
+ *
+ * The stream must be opened in binary mode. The result is not portable
+ * between builds with different floating point precision or byte order.
+ */
+void to_binary(std::ostream& os, OrangeInput const& value)
+{
+    CELER_EXPECT(value);
+
+    BinaryWriter write{os};
+    write.raw(magic);
+    write.raw(format_version);
+    write.raw(endian_check);
+    write.raw(static_cast<std::uint32_t>(sizeof(real_type)));
+
+    write.raw(value.tol.rel);
+    write.raw(value.tol.abs);
+
+    write.count(value.universes.size());
+    for (auto const& univ : value.universes)
+    {
+        write.raw(static_cast<std::uint32_t>(univ.index()));
+        std::visit(write, univ);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a filename uses the binary ORANGE extension.
+ */
+bool is_orange_binary_filename(std::string const& filename)
+{
+    return ends_with(filename, ".org.bin");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeInputIO.bin.hh
+//! \brief Compact binary serialization of ORANGE input
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <string>
+
+#include "OrangeInput.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Read an ORANGE input definition from a binary stream
+void from_binary(std::istream& is, OrangeInput& value);
+
+// Write an ORANGE input definition to a binary stream
+void to_binary(std::ostream& os, OrangeInput const& value);
+
+// Whether a filename uses the binary ORANGE extension
+bool is_orange_binary_filename(std::string const& filename);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -26,6 +26,7 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/sys/Environment.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "geocel/BoundingBox.hh"
@@ -33,6 +34,7 @@
 
 #include "OrangeData.hh"  // IWYU pragma: associated
 #include "OrangeInput.hh"
+#include "OrangeInputIO.bin.hh"
 #include "OrangeInputIO.json.hh"
 #include "OrangeTypes.hh"
 #include "g4org/Converter.hh"
@@ -67,6 +69,40 @@ OrangeInput input_from_json(std::string filename)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Load a geometry from the given binary file.
+ */
+OrangeInput input_from_binary(std::string filename)
+{
+    CELER_LOG(info) << "Loading ORANGE geometry from binary at " << filename;
+    ScopedTimeLog scoped_time;
+
+    OrangeInput result;
+
+    std::ifstream infile(filename, std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open geometry at '" << filename << '\'');
+    from_binary(infile, result);
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a Geant4 geometry, optionally saving the result.
+ *
+ * If the \c G4ORG_OUTPUT environment variable is set to a \c .org.bin
+ * filename, the converted input is written there so that later runs can load
+ * it directly.
+ */
+OrangeInput input_from_geant(G4VPhysicalVolume const* world)
+{
+    g4org::Converter::Options opts;
+    opts.binary_output_file = celeritas::getenv("G4ORG_OUTPUT");
+    return g4org::Converter{std::move(opts)}(world).input;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Load a geometry from the given filename.
@@ -80,7 +116,7 @@ OrangeInput input_from_file(std::string filename)
         {
             // Load with Geant4: must *not* be using run manager
             auto* world = ::celeritas::load_geant_geometry_native(filename);
-            auto result = g4org::Converter{}(world).input;
+            auto result = input_from_geant(world);
             ::celeritas::reset_geant_geometry();
             return result;
         }
@@ -93,10 +129,15 @@ OrangeInput input_from_file(std::string filename)
             filename += ".org.json";
         }
     }
+    else if (is_orange_binary_filename(filename))
+    {
+        return input_from_binary(std::move(filename));
+    }
     else
     {
         CELER_VALIDATE(ends_with(filename, ".json"),
-                       << "expected JSON extension for ORANGE input '"
+                       << "expected JSON or binary extension for ORANGE "
+                          "input '"
                        << filename << "'");
     }
     return input_from_json(std::move(filename));
@@ -110,7 +151,9 @@ OrangeInput input_from_file(std::string filename)
  * Construct from a JSON file (if JSON is enabled).
  *
  * The JSON format is defined by the SCALE ORANGE exporter (not currently
- * distributed).
+ * distributed). Files with a \c .org.bin extension are instead read using the
+ * compact binary format written by \c to_binary , which is much faster to
+ * load for large geometries.
  */
 OrangeParams::OrangeParams(std::string const& filename)
     : OrangeParams(input_from_file(filename))
@@ -124,7 +167,7 @@ OrangeParams::OrangeParams(std::string const& filename)
  * TODO: expose options? Fix volume mappings?
  */
 OrangeParams::OrangeParams(G4VPhysicalVolume const* world)
-    : OrangeParams(std::move(g4org::Converter{}(world).input))
+    : OrangeParams(input_from_geant(world))
 {
 }
 
@@ -10,6 +10,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/ThreadId.hh"
 
 #include "OrangeData.hh"
@@ -52,6 +53,13 @@ namespace celeritas
  *
  * \c move_internal with a position \em should depend on the safety distance
  * but that's not yet implemented.
+ *
+ * The most recently calculated safety distance and the global position where
+ * it was calculated are stored as a "safety sphere". Since no boundary lies
+ * inside the sphere, \c find_safety with a maximum distance that is still
+ * inside the sphere returns the remaining radius without querying the
+ * geometry. The sphere is invalidated when the track is initialized or moves
+ * to a boundary.
  */
 class OrangeTrackView
 {
@@ -216,6 +224,9 @@ class OrangeTrackView
     // Clear the surface on the current level
     inline CELER_FUNCTION void clear_surface();
 
+    // Invalidate the cached safety sphere
+    inline CELER_FUNCTION void clear_safety();
+
     // Make a LevelStateAccessor for the current thread and level
     inline CELER_FUNCTION LSA make_lsa() const;
 
@@ -340,6 +351,7 @@ OrangeTrackView::operator=(Initializer_t const& init)
     this->boundary(BoundaryResult::exiting);
     this->clear_surface();
     this->clear_next();
+    this->clear_safety();
 
     CELER_ENSURE(!this->has_next_step());
     return *this;
@@ -364,6 +376,12 @@ OrangeTrackView& OrangeTrackView::operator=(DetailedInitializer const& init)
                       {init.other.surf(), init.other.sense()});
         this->boundary(init.other.boundary());
 
+        // Share the parent's safety sphere since the position is unchanged
+        states_.safety_pos[track_slot_]
+            = states_.safety_pos[init.other.track_slot_];
+        states_.safety_radius[track_slot_]
+            = states_.safety_radius[init.other.track_slot_];
+
         for (auto lev : range(LevelId{this->level() + 1}))
         {
             // Copy all data accessed via LSA
@@ -549,6 +567,7 @@ CELER_FUNCTION void OrangeTrackView::move_to_boundary()
 
     this->surface(this->next_surface_level(), this->next_surf());
     this->clear_next();
+    this->clear_safety();
     CELER_ENSURE(this->is_on_boundary());
 }
 
@@ -985,6 +1004,11 @@ CELER_FUNCTION real_type OrangeTrackView::find_safety()
             lsa.universe());
         min_safety_dist = celeritas::min(min_safety_dist, sd);
     }
+
+    // Save the safety sphere
+    states_.safety_pos[track_slot_] = this->pos();
+    states_.safety_radius[track_slot_] = min_safety_dist;
+
     return min_safety_dist;
 }
 
@@ -993,10 +1017,23 @@ CELER_FUNCTION real_type OrangeTrackView::find_safety()
  * Find the distance to the nearest nearby boundary.
  *
  * Since we currently support only "simple" safety distances, we can't
- * eliminate anything by checking only nearby surfaces.
+ * eliminate anything by checking only nearby surfaces. However, if the
+ * track is still inside the last calculated safety sphere and at least \c
+ * max_step away from its surface, the remaining radius is a valid safety
+ * distance and the geometry isn't queried.
  */
-CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type)
+CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type max_step)
 {
+    CELER_EXPECT(!this->is_on_boundary());
+    CELER_EXPECT(max_step > 0);
+
+    real_type const remaining
+        = states_.safety_radius[track_slot_]
+          - distance(this->pos(), states_.safety_pos[track_slot_]);
+    if (remaining >= max_step)
+    {
+        return remaining;
+    }
     return this->find_safety();
 }
 
@@ -1109,6 +1146,15 @@ CELER_FUNCTION void OrangeTrackView::clear_surface()
     CELER_ENSURE(!this->is_on_boundary());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Invalidate the cached safety sphere.
+ */
+CELER_FUNCTION void OrangeTrackView::clear_safety()
+{
+    states_.safety_radius[track_slot_] = -1;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Make a LevelStateAccessor for the current thread and level.
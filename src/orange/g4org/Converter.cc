@@ -7,8 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "Converter.hh"
 
+#include <fstream>
+
 #include "corecel/io/Logger.hh"
+#include "corecel/io/ScopedTimeLog.hh"
 #include "geocel/detail/LengthUnits.hh"
+#include "orange/OrangeInputIO.bin.hh"
 #include "orange/orangeinp/InputBuilder.hh"
 
 #include "PhysicalVolumeConverter.hh"
@@ -37,6 +41,11 @@ Converter::Converter(Options&& opts) : opts_{std::move(opts)}
                "incomplete geometry simplification";
     }
 
+    CELER_VALIDATE(opts_.binary_output_file.empty()
+                       || is_orange_binary_filename(opts_.binary_output_file),
+                   << "expected '.org.bin' extension for binary ORANGE output '"
+                   << opts_.binary_output_file << "'");
+
     CELER_ENSURE(opts_.tol);
 }
 
@@ -71,6 +80,19 @@ auto Converter::operator()(arg_type g4world) -> result_type
         return ibo;
     }());
     result.input = build_input(*global_proto);
+
+    if (!opts_.binary_output_file.empty())
+    {
+        // Save the converted geometry so later runs can skip conversion
+        CELER_LOG(info) << "Writing converted ORANGE geometry to "
+                        << opts_.binary_output_file;
+        ScopedTimeLog scoped_time;
+        std::ofstream outfile(opts_.binary_output_file, std::ios::binary);
+        CELER_VALIDATE(outfile,
+                       << "failed to open binary ORANGE output at '"
+                       << opts_.binary_output_file << "'");
+        to_binary(outfile, result.input);
+    }
     return result;
 }
 
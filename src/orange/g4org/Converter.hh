@@ -67,6 +67,8 @@ class Converter
         std::string proto_output_file;
         //! Write intermediate debug ouput (CSG construction) to a JSON file
         std::string debug_output_file;
+        //! Write the converted ORANGE input to a binary (.org.bin) file
+        std::string binary_output_file;
     };
 
     struct result_type
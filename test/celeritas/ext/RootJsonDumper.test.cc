@@ -270,13 +270,15 @@ TEST_F(RootJsonDumperTest, all)
   "name" : "DefaultRegionForTheWorld",
   "field_manager" : false,
   "production_cuts" : true,
-  "user_limits" : false
+  "user_limits" : false,
+  "min_energy" : 0
 }, {
   "_typename" : "celeritas::ImportRegion",
   "name" : "DefaultRegionForParallelWorld",
   "field_manager" : false,
   "production_cuts" : true,
-  "user_limits" : false
+  "user_limits" : false,
+  "min_energy" : 0
 }],
 "volumes" : [{
   "_typename" : "celeritas::ImportVolume",
@@ -301,7 +303,8 @@ TEST_F(RootJsonDumperTest, all)
   "charge" : 1,
   "spin" : 0.5,
   "lifetime" : -1,
-  "is_stable" : true
+  "is_stable" : true,
+  "user_special_cuts" : false
 }, {
   "_typename" : "celeritas::ImportParticle",
   "name" : "mu-",
@@ -310,7 +313,8 @@ TEST_F(RootJsonDumperTest, all)
   "charge" : -1,
   "spin" : 0.5,
   "lifetime" : 2.19698e-6,
-  "is_stable" : false
+  "is_stable" : false,
+  "user_special_cuts" : false
 }],
 "processes" : [{
   "_typename" : "celeritas::ImportProcess",
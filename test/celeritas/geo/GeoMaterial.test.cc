@@ -5,16 +5,25 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/geo/GeoMaterial.test.cc
 //---------------------------------------------------------------------------//
+#include <iostream>
+
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/io/StringUtils.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "geocel/UnitUtils.hh"
 #include "celeritas/geo/GeoData.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoMaterialView.hh"
 #include "celeritas/geo/GeoParams.hh"
 #include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/Units.hh"
 #include "celeritas/mat/MaterialParams.hh"
 
 #include "celeritas_test.hh"
+#include "../GlobalGeoTestBase.hh"
+#include "../OnlyCoreTestBase.hh"
+#include "../OnlyGeoTestBase.hh"
 #include "../RootTestBase.hh"
 #include "../TestEm3Base.hh"
 
@@ -30,6 +39,13 @@ class GeoMaterialTestBase : virtual public GlobalTestBase
 {
   public:
     using VecString = std::vector<std::string>;
+    using VecReal3 = std::vector<Real3>;
+
+    struct CrossingCount
+    {
+        size_type crossings{0};
+        size_type material_changes{0};
+    };
 
   protected:
     std::string material_name(MaterialId matid) const
@@ -40,6 +56,9 @@ class GeoMaterialTestBase : virtual public GlobalTestBase
     }
 
     VecString trace_materials(Real3 const& pos, Real3 dir);
+    CrossingCount cross_materials(VecReal3 const& starts_cm,
+                                  Real3 dir,
+                                  bool find_material);
 };
 
 auto GeoMaterialTestBase::trace_materials(Real3 const& pos_cm,
@@ -69,6 +88,45 @@ auto GeoMaterialTestBase::trace_materials(Real3 const& pos_cm,
     return result;
 }
 
+/*!
+ * Cross all boundaries along parallel rays.
+ *
+ * If requested, the material is looked up after each crossing as in the
+ * boundary action.
+ */
+auto GeoMaterialTestBase::cross_materials(VecReal3 const& starts_cm,
+                                          Real3 dir,
+                                          bool find_material) -> CrossingCount
+{
+    CollectionStateStore<GeoStateData, MemSpace::host> host_state{
+        this->geometry()->host_ref(), 1};
+    GeoTrackView geo(
+        this->geometry()->host_ref(), host_state.ref(), TrackSlotId{0});
+    GeoMaterialView geo_mat_view(this->geomaterial()->host_ref());
+
+    CrossingCount result;
+    dir = make_unit_vector(dir);
+    for (Real3 const& pos_cm : starts_cm)
+    {
+        geo = {from_cm(pos_cm), dir};
+        MaterialId matid;
+        while (!geo.is_outside())
+        {
+            geo.find_next_step();
+            geo.move_to_boundary();
+            geo.cross_boundary();
+            ++result.crossings;
+            if (find_material && !geo.is_outside())
+            {
+                auto new_matid = geo_mat_view.material_id(geo.volume_id());
+                result.material_changes += (new_matid != matid);
+                matid = new_matid;
+            }
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 
 #define SimpleCmsRoot TEST_IF_CELERITAS_USE_ROOT(SimpleCmsRoot)
@@ -90,6 +148,70 @@ class TestEm3 : public TestEm3Base, public GeoMaterialTestBase
 {
 };
 
+//---------------------------------------------------------------------------//
+// TestEm3 calorimeter with materials defined by hand
+class TestEm3Flat : public GlobalGeoTestBase,
+                    public OnlyGeoTestBase,
+                    public OnlyCoreTestBase,
+                    public GeoMaterialTestBase
+{
+  public:
+    std::string_view geometry_basename() const override
+    {
+        return "testem3-flat"sv;
+    }
+
+    SPConstMaterial build_material() override
+    {
+        using namespace units;
+
+        MaterialParams::Input inp;
+        inp.elements = {{AtomicNumber{82}, AmuMass{207.2}, {}, "Pb"},
+                        {AtomicNumber{18}, AmuMass{39.95}, {}, "Ar"}};
+        inp.materials = {{native_value_from(MolCcDensity{0.05478}),
+                          293.0,
+                          MatterState::solid,
+                          {{ElementId{0}, 1.0}},
+                          "Pb"},
+                         {native_value_from(MolCcDensity{0.03494}),
+                          87.0,
+                          MatterState::liquid,
+                          {{ElementId{1}, 1.0}},
+                          "lAr"},
+                         {0, 0, MatterState::unspecified, {}, "vacuum"}};
+        return std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        // Gaps are lead, absorbers are liquid argon
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        auto const& geo = *this->geometry();
+        for (auto vol_id : range(VolumeId{geo.num_volumes()}))
+        {
+            Label const& label = geo.id_to_label(vol_id);
+            MaterialId mat;
+            if (starts_with(label.name, "gap_"))
+            {
+                mat = MaterialId{0};
+            }
+            else if (starts_with(label.name, "absorber_"))
+            {
+                mat = MaterialId{1};
+            }
+            else if (label.name == "world")
+            {
+                mat = MaterialId{2};
+            }
+            input.volume_to_mat.push_back(mat);
+            input.volume_labels.push_back(label);
+        }
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+};
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -110,6 +232,42 @@ TEST_F(TestEm3, plus_x)
     EXPECT_VEC_EQ(expected_materials, materials);
 }
 
+TEST_F(TestEm3Flat, plus_x)
+{
+    auto materials = this->trace_materials({19.01, 0, 0}, {1, 0, 0});
+    static char const* const expected_materials[]
+        = {"lAr", "Pb", "lAr", "vacuum"};
+    EXPECT_VEC_EQ(expected_materials, materials);
+}
+
+// Cost of looking up the material after each boundary crossing
+TEST_F(TestEm3Flat, DISABLED_crossing_performance)
+{
+    // Offset the rays transversely across the calorimeter face
+    size_type const num_rays = 10000;
+    VecReal3 starts(num_rays);
+    for (auto i : range(num_rays))
+    {
+        real_type y = -10 + real_type(20) * i / num_rays;
+        starts[i] = {-22, y, 0.5};
+    }
+
+    for (bool find_material : {false, true, false, true})
+    {
+        Stopwatch get_time;
+        auto counts = this->cross_materials(starts, {1, 0, 0}, find_material);
+        double time = get_time();
+
+        EXPECT_EQ(find_material ? 101 * num_rays : 0,
+                  counts.material_changes);
+        std::cout << (find_material ? "With" : "Without")
+                  << " material lookup: crossed " << counts.crossings
+                  << " boundaries in " << time << " s ("
+                  << time / counts.crossings * 1e9 << " ns/crossing)"
+                  << std::endl;
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
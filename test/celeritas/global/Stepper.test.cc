@@ -7,8 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/global/Stepper.hh"
 
+#include <cstring>
+#include <map>
 #include <memory>
 #include <random>
+#include <utility>
 
 #include "corecel/ScopedLogStorer.hh"
 #include "corecel/Types.hh"
@@ -21,10 +24,13 @@
 #include "geocel/UnitUtils.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
+#include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/random/RngData.hh"
 #include "celeritas/track/SimTrackView.hh"
+#include "celeritas/track/TrackSuspension.hh"
 
 #include "DummyAction.hh"
 #include "StepperTestBase.hh"
@@ -212,6 +218,144 @@ TEST_F(SimpleComptonTest, host)
     EXPECT_EQ(3, result.calc_emptying_step());
 }
 
+TEST_F(SimpleComptonTest, suspend_resume)
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 16;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+
+    // Transport a few steps with more primaries than track slots
+    auto primaries = this->make_primaries(num_primaries);
+    auto counts = step(make_span(primaries));
+    for ([[maybe_unused]] auto i : range(3))
+    {
+        counts = step();
+    }
+    ASSERT_TRUE(counts);
+    EXPECT_LT(0, counts.queued);
+    size_type const num_pending = counts.alive + counts.queued;
+
+    // Suspend all tracks and initializers
+    auto suspended = step.suspend();
+    EXPECT_EQ(num_pending, suspended.size());
+    EXPECT_EQ(4096, suspended.track_counters.size());
+    EXPECT_EQ(num_tracks, step.state().counters().num_vacancies);
+    EXPECT_EQ(0, step.state().counters().num_initializers);
+    EXPECT_FALSE(step());
+
+    // Tracks that were in flight are resumed first
+    ASSERT_FALSE(suspended.empty());
+    EXPECT_LT(0, suspended.tracks.back().num_steps);
+    EXPECT_EQ(0, suspended.tracks.front().num_steps);
+
+    // Resume only as many tracks as there are empty slots
+    size_type num_resumed = step.resume(&suspended);
+    EXPECT_EQ(num_tracks, num_resumed);
+    EXPECT_EQ(num_pending - num_tracks, suspended.size());
+    EXPECT_EQ(0, step.resume(&suspended));
+    EXPECT_EQ(num_tracks, step.state().counters().num_active);
+
+    // Transport the suspended tracks to completion
+    size_type remaining_steps = this->max_average_steps() * num_primaries;
+    do
+    {
+        num_resumed += step.resume(&suspended);
+        counts = step();
+    } while ((counts || !suspended.empty()) && --remaining_steps > 0);
+    EXPECT_FALSE(counts);
+    EXPECT_TRUE(suspended.empty());
+    EXPECT_EQ(num_pending, num_resumed);
+}
+
+TEST_F(SimpleComptonTest, suspend_state)
+{
+    using TrackKey = std::pair<EventId, TrackId>;
+
+    size_type num_tracks = 16;
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+    auto primaries = this->make_primaries(num_tracks);
+    // Take one step past the primaries, while all tracks are in flight and
+    // some are on the inner box boundary
+    auto counts = step(make_span(primaries));
+    counts = step();
+    ASSERT_TRUE(counts);
+
+    auto const& params = this->core()->host_ref();
+    HostRef<CoreStateData> state = step.state_ref();
+    auto same_rng = [](RngThreadState const& a, RngThreadState const& b) {
+        return std::memcmp(&a, &b, sizeof(RngThreadState)) == 0;
+    };
+
+    // Save the RNG state of each track in flight
+    std::map<TrackKey, std::pair<TrackSlotId, RngThreadState>> before;
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        CoreTrackView track{params, state, tid};
+        auto sim = track.make_sim_view();
+        if (sim.status() != TrackStatus::inactive)
+        {
+            before[{sim.event_id(), sim.track_id()}]
+                = {tid, get_rng_thread_state(state.rng, tid)};
+        }
+    }
+    ASSERT_FALSE(before.empty());
+
+    // Suspended tracks keep their RNG state, and the slots they leave don't
+    // repeat it
+    auto suspended = step.suspend();
+    std::map<TrackKey, SuspendedTrack> saved;
+    size_type num_on_boundary{0};
+    for (SuspendedTrack const& t : suspended.tracks)
+    {
+        TrackKey key{t.init.sim.event_id, t.init.sim.track_id};
+        auto iter = before.find(key);
+        if (iter == before.end())
+        {
+            EXPECT_FALSE(t.has_rng);
+            continue;
+        }
+        ASSERT_TRUE(t.has_rng);
+        EXPECT_TRUE(same_rng(iter->second.second, t.rng));
+        EXPECT_FALSE(same_rng(
+            t.rng, get_rng_thread_state(state.rng, iter->second.first)));
+        if (t.boundary_volume)
+        {
+            ++num_on_boundary;
+        }
+        saved[key] = t;
+    }
+    EXPECT_EQ(before.size(), saved.size());
+    EXPECT_LT(0, num_on_boundary);
+
+    // Resumed tracks continue their RNG stream and are on the same boundary
+    step.resume(&suspended);
+    size_type num_checked{0};
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        CoreTrackView track{params, state, tid};
+        auto sim = track.make_sim_view();
+        auto iter = saved.find({sim.event_id(), sim.track_id()});
+        if (sim.status() == TrackStatus::inactive || iter == saved.end())
+        {
+            continue;
+        }
+        ++num_checked;
+        SuspendedTrack const& t = iter->second;
+        EXPECT_TRUE(same_rng(t.rng, get_rng_thread_state(state.rng, tid)));
+
+        auto geo = track.make_geo_view();
+        EXPECT_EQ(static_cast<bool>(t.boundary_volume), geo.is_on_boundary());
+        if (t.boundary_volume)
+        {
+            EXPECT_EQ(t.boundary_volume, geo.volume_id());
+        }
+        EXPECT_VEC_SOFT_EQ(t.init.geo.pos, geo.pos());
+        EXPECT_VEC_SOFT_EQ(t.init.geo.dir, geo.dir());
+    }
+    EXPECT_LT(0, num_checked);
+}
+
 TEST_F(SimpleComptonTest, TEST_IF_CELER_DEVICE(device))
 {
     size_type num_primaries = 32;
@@ -0,0 +1,378 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StreamPool.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/StreamPool.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Abort the step if any track is later than a given time.
+ */
+class PoisonAction final : public CoreStepActionInterface,
+                           public ConcreteAction
+{
+  public:
+    PoisonAction(ActionId id, real_type max_time)
+        : ConcreteAction{id, "poison"}, max_time_{max_time}
+    {
+    }
+
+    void step(CoreParams const& params, CoreStateHost& state) const final
+    {
+        for (auto tid : range(TrackSlotId{state.size()}))
+        {
+            CoreTrackView track(params.host_ref(), state.ref(), tid);
+            auto sim = track.make_sim_view();
+            CELER_VALIDATE(
+                sim.status() == TrackStatus::inactive
+                    || sim.time() < max_time_,
+                << "poisoned track");
+        }
+    }
+
+    void step(CoreParams const&, CoreStateDevice&) const final
+    {
+        CELER_NOT_IMPLEMENTED("poison action on device");
+    }
+
+    StepActionOrder order() const final { return StepActionOrder::user_pre; }
+
+  private:
+    real_type max_time_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hold a stream thread after a step until released by the test.
+ */
+class StreamGate
+{
+  public:
+    //! Hold the next thread to pass
+    void close()
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        open_ = false;
+        entered_ = false;
+    }
+
+    //! Called by the stream thread
+    void pass()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        entered_ = true;
+        changed_.notify_all();
+        changed_.wait(lock, [this] { return open_; });
+    }
+
+    //! Wait until the stream thread is held
+    void wait_entered()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        changed_.wait(lock, [this] { return entered_; });
+    }
+
+    //! Release the stream thread
+    void open()
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex_};
+        open_ = true;
+        changed_.notify_all();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    bool open_{true};
+    bool entered_{false};
+};
+
+//---------------------------------------------------------------------------//
+
+class StreamPoolTest : public SimpleTestBase
+{
+  protected:
+    using VecPrimary = StreamPool::VecPrimary;
+    using VecHits = StreamPool::VecHits;
+    using Clock = StreamPool::Clock;
+
+    static constexpr size_type max_merged = 4;
+
+    void SetUp() override
+    {
+        auto& action_reg = *this->action_reg();
+        action_reg.insert(std::make_shared<PoisonAction>(
+            action_reg.next_id(), real_type(0.5) * units::second));
+    }
+
+    StreamPoolInput make_input()
+    {
+        StreamPoolInput inp;
+        inp.params = this->core();
+        inp.num_streams = 1;
+        inp.num_track_slots = 16;
+        inp.max_steps = 100000;
+        inp.max_merged = max_merged;
+        inp.merge_threshold = 1;
+        inp.take_hits = [this](StreamId sid) {
+            EXPECT_EQ(StreamId{0}, sid);
+            ++num_take_hits_;
+            gate_.pass();
+            // One fake step for every possible submission in the batch
+            DetectorStepOutput steps;
+            for (auto i : range(max_merged))
+            {
+                steps.detector.push_back(DetectorId{0});
+                steps.track_id.push_back(TrackId{0});
+                steps.event_id.push_back(EventId{i});
+            }
+            return VecHits{std::move(steps)};
+        };
+        return inp;
+    }
+
+    //! Make gammas along +x, starting at a given time
+    VecPrimary make_primaries(size_type count, real_type time = 0) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{100};
+        p.position = from_cm(Real3{-22, 0, 0});
+        p.direction = {1, 0, 0};
+        p.time = time;
+        return VecPrimary(count, p);
+    }
+
+    //! Create a completion that records the order events finish in
+    StreamPool::Completion
+    make_logged(StreamPoolResults* results, UniqueEventId event)
+    {
+        return [this, event, complete = results->make_completion()](
+                   VecHits&& hits, std::exception_ptr error) {
+            {
+                std::lock_guard<std::mutex> scoped_lock{order_mutex_};
+                completed_.push_back(event.get());
+            }
+            complete(std::move(hits), error);
+        };
+    }
+
+    //! Get the order of completed events
+    std::vector<int> completed()
+    {
+        std::lock_guard<std::mutex> scoped_lock{order_mutex_};
+        return {completed_.begin(), completed_.end()};
+    }
+
+    std::atomic<int> num_take_hits_{0};
+    StreamGate gate_;
+    std::mutex order_mutex_;
+    std::vector<UniqueEventId::size_type> completed_;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(StreamPoolTest, host)
+{
+    StreamPool pool(this->make_input());
+    EXPECT_EQ(1, pool.num_streams());
+
+    // Two client threads submitting several times from their own events
+    StreamPoolResults first;
+    StreamPoolResults second;
+    for (auto i : range(3))
+    {
+        CELER_DISCARD(i);
+        pool.submit(this->make_primaries(4),
+                    UniqueEventId{1},
+                    first.make_completion());
+    }
+    for (auto i : range(2))
+    {
+        CELER_DISCARD(i);
+        pool.submit(this->make_primaries(4),
+                    UniqueEventId{2},
+                    second.make_completion());
+    }
+
+    // Every submission gets the steps from its tracks
+    auto first_hits = first.wait();
+    EXPECT_EQ(0, first.pending());
+    EXPECT_GE(first_hits.size(), 3);
+    auto second_hits = second.wait();
+    EXPECT_EQ(0, second.pending());
+    EXPECT_GE(second_hits.size(), 2);
+    EXPECT_GE(num_take_hits_, 5);
+}
+
+TEST_F(StreamPoolTest, error)
+{
+    StreamPool pool(this->make_input());
+
+    // Submit a failing and a good submission from one event, and good
+    // submissions from another event that are eligible for merging
+    StreamPoolResults bad;
+    StreamPoolResults good;
+    pool.submit(this->make_primaries(2, 1 * units::second),
+                UniqueEventId{1},
+                bad.make_completion());
+    pool.submit(
+        this->make_primaries(2), UniqueEventId{1}, bad.make_completion());
+    pool.submit(
+        this->make_primaries(2), UniqueEventId{2}, good.make_completion());
+    pool.submit(
+        this->make_primaries(2), UniqueEventId{2}, good.make_completion());
+
+    // Only the failing event's submissions get the error
+    EXPECT_THROW(bad.wait(), RuntimeError);
+    EXPECT_EQ(0, bad.pending());
+    VecHits hits;
+    EXPECT_NO_THROW(hits = good.wait());
+    EXPECT_GE(hits.size(), 2);
+
+    // The stream recovers for later submissions
+    StreamPoolResults later;
+    pool.submit(
+        this->make_primaries(2), UniqueEventId{3}, later.make_completion());
+    EXPECT_NO_THROW(later.wait());
+}
+
+TEST_F(StreamPoolTest, round_robin)
+{
+    auto inp = this->make_input();
+    inp.max_merged = 1;
+    StreamPool pool(std::move(inp));
+
+    // Hold the stream while transporting the first event
+    StreamPoolResults results;
+    gate_.close();
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{1},
+                this->make_logged(&results, UniqueEventId{1}));
+    gate_.wait_entered();
+
+    // Another submission from the same event waits for the other event
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{1},
+                this->make_logged(&results, UniqueEventId{1}));
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{2},
+                this->make_logged(&results, UniqueEventId{2}));
+    gate_.open();
+    results.wait();
+
+    static int const expected_completed[] = {1, 2, 1};
+    EXPECT_VEC_EQ(expected_completed, this->completed());
+}
+
+TEST_F(StreamPoolTest, deadline)
+{
+    StreamPool pool(this->make_input());
+
+    StreamPoolResults results;
+    gate_.close();
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{1},
+                this->make_logged(&results, UniqueEventId{1}));
+    gate_.wait_entered();
+
+    // The submission with a deadline is started first
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{2},
+                this->make_logged(&results, UniqueEventId{2}));
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{3},
+                this->make_logged(&results, UniqueEventId{3}),
+                Clock::now() + std::chrono::hours(1));
+    gate_.open();
+    results.wait();
+
+    static int const expected_completed[] = {1, 3, 2};
+    EXPECT_VEC_EQ(expected_completed, this->completed());
+
+    // A submission that can't finish before its deadline fails
+    StreamPoolResults late;
+    pool.submit(this->make_primaries(2),
+                UniqueEventId{4},
+                late.make_completion(),
+                Clock::now() - std::chrono::seconds(1));
+    EXPECT_THROW(late.wait(), RuntimeError);
+
+    // The stream recovers for later submissions
+    StreamPoolResults later;
+    pool.submit(
+        this->make_primaries(2), UniqueEventId{5}, later.make_completion());
+    EXPECT_NO_THROW(later.wait());
+}
+
+TEST_F(StreamPoolTest, time_slicing)
+{
+    // Without slicing, a long batch is transported to completion first
+    for (size_type slice_steps : {0, 2})
+    {
+        auto inp = this->make_input();
+        inp.slice_steps = slice_steps;
+        StreamPool pool(std::move(inp));
+        completed_.clear();
+
+        StreamPoolResults results;
+        gate_.close();
+        pool.submit(this->make_primaries(16),
+                    UniqueEventId{1},
+                    this->make_logged(&results, UniqueEventId{1}));
+        gate_.wait_entered();
+        pool.submit(this->make_primaries(1),
+                    UniqueEventId{2},
+                    this->make_logged(&results, UniqueEventId{2}));
+        gate_.open();
+
+        // Suspended tracks are resumed and their hits are still returned
+        VecHits hits;
+        EXPECT_NO_THROW(hits = results.wait());
+        EXPECT_GE(hits.size(), 2);
+        if (slice_steps == 0)
+        {
+            static int const expected_completed[] = {1, 2};
+            EXPECT_VEC_EQ(expected_completed, this->completed());
+        }
+        else
+        {
+            // With slicing, the short batch finishes first
+            static int const expected_completed[] = {2, 1};
+            EXPECT_VEC_EQ(expected_completed, this->completed());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,235 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TelemetryWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/TelemetryWriter.hh"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#ifndef _WIN32
+#    include <cstring>
+#    include <sys/socket.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+#endif
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class TelemetryWriterTest : public ::celeritas::test::Test
+{
+  protected:
+    using MapStrDouble = TelemetryWriter::MapStrDouble;
+
+    //! Write a snapshot with one action time for every step
+    static constexpr double short_interval = 1e-4;
+
+    //! Sleep long enough for the short interval to elapse
+    static void wait_interval()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    //! Step with the given counts, counting calls for action times
+    void step(TelemetryWriter& write, StreamId stream, StepperResult counts)
+    {
+        write(stream, counts, [this](MapStrDouble* times) {
+            ++num_accum_;
+            (*times)["along-step"] = 1.5;
+        });
+    }
+
+    //! Get a new file name, removing output from previous runs
+    std::string make_filename()
+    {
+        std::string result = this->make_unique_filename(".jsonl");
+        std::remove(result.c_str());
+        return result;
+    }
+
+    //! Read snapshots from a file
+    static std::vector<nlohmann::json> read_lines(std::string const& filename)
+    {
+        std::vector<nlohmann::json> result;
+        std::ifstream infile(filename);
+        std::string line;
+        while (std::getline(infile, line))
+        {
+            result.push_back(nlohmann::json::parse(line));
+        }
+        return result;
+    }
+
+    //! Get the writer's diagnostic output
+    static nlohmann::json get_output(TelemetryWriter const& write)
+    {
+        return nlohmann::json::parse(to_string(write));
+    }
+
+    int num_accum_{0};
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(TelemetryWriterTest, contents)
+{
+    std::string filename = this->make_filename();
+    {
+        TelemetryWriter write(filename, short_interval, 2);
+
+        StepperResult counts;
+        counts.queued = 5;
+        counts.spilled = 1;
+        counts.active = 10;
+        counts.alive = 8;
+        counts.secondaries = 3;
+        this->wait_interval();
+        this->step(write, StreamId{1}, counts);
+
+        // High-water marks are reset after each snapshot
+        counts.queued = 2;
+        counts.spilled = 0;
+        counts.active = 8;
+        counts.alive = 4;
+        counts.secondaries = 1;
+        this->wait_interval();
+        this->step(write, StreamId{1}, counts);
+
+        auto out = get_output(write);
+        EXPECT_EQ(2, out["num_snapshots"].get<int>());
+        EXPECT_FALSE(out["failed"].get<bool>());
+        EXPECT_EQ(filename, out["destination"].get<std::string>());
+    }
+    EXPECT_EQ(2, num_accum_);
+
+    auto lines = read_lines(filename);
+    ASSERT_EQ(2, lines.size());
+
+    auto const& first = lines[0];
+    EXPECT_EQ(1, first["stream"].get<int>());
+    EXPECT_EQ(1, first["num_step_iterations"].get<int>());
+    EXPECT_EQ(10, first["num_steps"].get<int>());
+    EXPECT_GT(first["steps_per_sec"].get<double>(), 0);
+    EXPECT_EQ(10, first["active"].get<int>());
+    EXPECT_EQ(5, first["queued"].get<int>());
+    EXPECT_EQ(8, first["alive"].get<int>());
+    EXPECT_EQ(5, first["max_queued"].get<int>());
+    EXPECT_EQ(1, first["max_spilled"].get<int>());
+    EXPECT_EQ(3, first["max_secondaries"].get<int>());
+    EXPECT_DOUBLE_EQ(1.5, first["action_times"]["along-step"].get<double>());
+
+    auto const& second = lines[1];
+    EXPECT_GT(second["time"].get<double>(), first["time"].get<double>());
+    EXPECT_EQ(2, second["num_step_iterations"].get<int>());
+    EXPECT_EQ(18, second["num_steps"].get<int>());
+    EXPECT_EQ(2, second["max_queued"].get<int>());
+    EXPECT_EQ(0, second["max_spilled"].get<int>());
+    EXPECT_EQ(1, second["max_secondaries"].get<int>());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(TelemetryWriterTest, interval)
+{
+    std::string filename = this->make_filename();
+    TelemetryWriter write(filename, 0.05, 2);
+
+    StepperResult counts;
+    counts.active = 4;
+    counts.alive = 4;
+    counts.queued = 7;
+
+    // No snapshot before the interval has elapsed
+    this->step(write, StreamId{0}, counts);
+    this->step(write, StreamId{1}, counts);
+    EXPECT_EQ(0, num_accum_);
+    EXPECT_EQ(0, get_output(write)["num_snapshots"].get<int>());
+
+    // Each stream writes once the interval has elapsed since its last write
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    counts.queued = 3;
+    this->step(write, StreamId{0}, counts);
+    this->step(write, StreamId{0}, counts);
+    EXPECT_EQ(1, num_accum_);
+    this->step(write, StreamId{1}, counts);
+    EXPECT_EQ(2, num_accum_);
+
+    auto lines = read_lines(filename);
+    ASSERT_EQ(2, lines.size());
+    EXPECT_EQ(0, lines[0]["stream"].get<int>());
+    EXPECT_EQ(2, lines[0]["num_step_iterations"].get<int>());
+    EXPECT_EQ(8, lines[0]["num_steps"].get<int>());
+    EXPECT_EQ(7, lines[0]["max_queued"].get<int>());
+    EXPECT_EQ(1, lines[1]["stream"].get<int>());
+}
+
+//---------------------------------------------------------------------------//
+#ifndef _WIN32
+TEST_F(TelemetryWriterTest, failed_latch)
+{
+    // Listen on a Unix domain socket
+    std::string path = this->make_unique_filename(".sock");
+    ::unlink(path.c_str());
+    sockaddr_un addr{};
+    ASSERT_LT(path.size(), sizeof(addr.sun_path));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(server, 0);
+    ASSERT_EQ(0,
+              ::bind(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)));
+    ASSERT_EQ(0, ::listen(server, 1));
+
+    TelemetryWriter write("unix:" + path, short_interval, 1);
+    int client = ::accept(server, nullptr, nullptr);
+    ASSERT_GE(client, 0);
+
+    StepperResult counts;
+    counts.active = 2;
+    this->wait_interval();
+    this->step(write, StreamId{0}, counts);
+
+    // Read the snapshot from the socket
+    std::string received(4096, '\0');
+    auto num_read = ::recv(client, received.data(), received.size(), 0);
+    ASSERT_GT(num_read, 0);
+    received.resize(static_cast<std::size_t>(num_read));
+    ASSERT_EQ('\n', received.back());
+    EXPECT_EQ(2, nlohmann::json::parse(received)["num_steps"].get<int>());
+    EXPECT_EQ(1, get_output(write)["num_snapshots"].get<int>());
+
+    // Disconnecting the reader fails the next write without raising SIGPIPE
+    ::close(client);
+    ::close(server);
+    this->wait_interval();
+    this->step(write, StreamId{0}, counts);
+    auto out = get_output(write);
+    EXPECT_TRUE(out["failed"].get<bool>());
+    EXPECT_EQ(1, out["num_snapshots"].get<int>());
+
+    // Later snapshots are dropped
+    this->wait_interval();
+    this->step(write, StreamId{0}, counts);
+    out = get_output(write);
+    EXPECT_TRUE(out["failed"].get<bool>());
+    EXPECT_EQ(1, out["num_snapshots"].get<int>());
+
+    ::unlink(path.c_str());
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -123,6 +123,33 @@ TEST_F(ValueGridBuilderTest, log_grid)
     }
 }
 
+TEST_F(ValueGridBuilderTest, dedupe)
+{
+    using Builder_t = ValueGridLogBuilder;
+
+    VecBuilder entries;
+    entries.push_back(make_shared<Builder_t>(1e1, 1e3, VeDbl{.1, .2, .3}));
+    entries.push_back(make_shared<Builder_t>(1e1, 1e3, VeDbl{.4, .5, .6}));
+    entries.push_back(make_shared<Builder_t>(1e2, 1e4, VeDbl{.1, .2, .3}));
+    entries.push_back(make_shared<Builder_t>(1e1, 1e3, VeDbl{.4, .5, .6}));
+
+    // Build
+    this->build(entries);
+
+    // Grids with identical values share storage
+    ASSERT_EQ(4, grid_storage.size());
+    EXPECT_EQ(6, real_storage.size());
+    EXPECT_EQ(*grid_storage[XsIndex{0}].value.begin(),
+              *grid_storage[XsIndex{2}].value.begin());
+    EXPECT_EQ(*grid_storage[XsIndex{1}].value.begin(),
+              *grid_storage[XsIndex{3}].value.begin());
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{2}], real_ref);
+        EXPECT_SOFT_EQ(0.1, calc_xs(Energy{1e2}));
+        EXPECT_SOFT_EQ(0.3, calc_xs(Energy{1e4}));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
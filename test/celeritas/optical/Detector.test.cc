@@ -0,0 +1,253 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/Detector.test.cc
+//---------------------------------------------------------------------------//
+#include <vector>
+
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/optical/CoreParams.hh"
+#include "celeritas/optical/CoreState.hh"
+#include "celeritas/optical/CoreTrackView.hh"
+#include "celeritas/optical/DetectorData.hh"
+#include "celeritas/optical/MaterialParams.hh"
+#include "celeritas/optical/TrackInitParams.hh"
+#include "celeritas/optical/TrackInitializer.hh"
+#include "celeritas/optical/action/DetectorAction.hh"
+#include "celeritas/optical/action/detail/DetectorImpl.hh"
+#include "celeritas/optical/detail/OpticalUtils.hh"
+
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class DetectorTest : public ::celeritas::test::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Four volumes: sensors in volumes 3 and 1
+        HostVal<DetectorParamsData> host_params;
+        std::vector<DetectorId> detector{
+            {}, DetectorId{1}, {}, DetectorId{0}};
+        make_builder(&host_params.detector)
+            .insert_back(detector.begin(), detector.end());
+        host_params.num_detectors = 2;
+        host_params.num_time_bins = 4;
+        host_params.time_max = 4 * units::nanosecond;
+        params_ = CollectionMirror<DetectorParamsData>{std::move(host_params)};
+    }
+
+    DetectorHit make_hit(DetectorId::size_type det,
+                         real_type time_ns,
+                         real_type energy_ev,
+                         real_type weight) const
+    {
+        DetectorHit hit;
+        hit.detector = DetectorId{det};
+        hit.event = EventId{0};
+        hit.time = time_ns * units::nanosecond;
+        hit.energy = units::MevEnergy{energy_ev * 1e-6};
+        hit.weight = weight;
+        return hit;
+    }
+
+    CollectionMirror<DetectorParamsData> params_;
+};
+
+//---------------------------------------------------------------------------//
+
+class DetectorActionTest : public ::celeritas::test::SimpleTestBase
+{
+  protected:
+    void SetUp() override
+    {
+        auto const& geo = *this->geometry();
+
+        CoreParams::Input inp;
+        inp.geometry = this->geometry();
+        inp.material = [&geo] {
+            // Uniform refractive index everywhere
+            MaterialParams::Input mat;
+            ImportOpticalProperty prop;
+            prop.refractive_index.vector_type = ImportPhysicsVectorType::free;
+            prop.refractive_index.x = {1e-6, 1e-5};
+            prop.refractive_index.y = {1.3, 1.4};
+            mat.properties.push_back(std::move(prop));
+            mat.volume_to_mat.assign(geo.num_volumes(), OpticalMaterialId{0});
+            return std::make_shared<MaterialParams>(mat);
+        }();
+        inp.rng = this->rng();
+        inp.init = std::make_shared<TrackInitParams>(16);
+        inp.action_reg = std::make_shared<ActionRegistry>();
+        optical_ = std::make_shared<CoreParams>(std::move(inp));
+
+        // Detect photons entering the inner box
+        DetectorAction::Input det_inp;
+        det_inp.volumes = {geo.find_volume("inner")};
+        det_inp.num_time_bins = 2;
+        det_inp.time_max = 2 * units::nanosecond;
+        det_inp.callback = [this](StreamId, Span<DetectorHit const> hits) {
+            hits_.insert(hits_.end(), hits.begin(), hits.end());
+        };
+        auto& reg = *optical_->action_reg();
+        action_ = std::make_shared<DetectorAction>(
+            reg.next_id(), *optical_, std::move(det_inp));
+        reg.insert(action_);
+    }
+
+    //! Initialize a photon that just crossed a boundary
+    void init_track(CoreState<MemSpace::host>& state,
+                    TrackSlotId slot,
+                    Real3 const& pos,
+                    EventId event,
+                    real_type weight,
+                    bool on_boundary = true,
+                    real_type time = 0.5 * units::nanosecond)
+    {
+        CoreTrackView track(optical_->host_ref(), state.ref(), slot);
+        TrackInitializer init;
+        init.energy = units::MevEnergy{3e-6};
+        init.position = pos;
+        init.direction = {1, 0, 0};
+        init.polarization = {0, 1, 0};
+        init.time = time;
+        init.weight = weight;
+        init.event_id = event;
+        track = init;
+
+        auto sim = track.sim();
+        sim.status(TrackStatus::alive);
+        sim.post_step_action(on_boundary
+                                 ? optical_->host_ref().scalars.boundary_action
+                                 : ActionId{});
+    }
+
+    std::shared_ptr<CoreParams> optical_;
+    std::shared_ptr<DetectorAction> action_;
+    std::vector<DetectorHit> hits_;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(DetectorTest, accumulate)
+{
+    DetectorAction::Tally tally;
+
+    // Two hits in detector 0, one in detector 1, one late arrival
+    for (auto const& hit : {this->make_hit(0, 0.5, 2.5, 1.0),
+                            this->make_hit(1, 3.5, 3.0, 2.0),
+                            this->make_hit(0, 1.5, 2.5, 0.5),
+                            this->make_hit(0, 100, 2.5, 1.0)})
+    {
+        detail::accumulate_hit(params_.host_ref(), hit, &tally);
+    }
+
+    static real_type const expected_count[] = {2.5, 2.0};
+    EXPECT_VEC_SOFT_EQ(expected_count, tally.count);
+
+    real_type const lambda0
+        = detail::energy_to_wavelength(units::MevEnergy{2.5e-6});
+    real_type const lambda1
+        = detail::energy_to_wavelength(units::MevEnergy{3.0e-6});
+    std::vector<real_type> expected_wavelength{2.5 * lambda0, 2.0 * lambda1};
+    EXPECT_VEC_SOFT_EQ(expected_wavelength, tally.wavelength);
+
+    static real_type const expected_time_hist[]
+        = {1, 0.5, 0, 0, 0, 0, 0, 2};
+    EXPECT_VEC_SOFT_EQ(expected_time_hist, tally.time_hist);
+    static real_type const expected_overflow[] = {1, 0};
+    EXPECT_VEC_SOFT_EQ(expected_overflow, tally.overflow);
+
+    // Tallies add elementwise, and empty tallies are ignored
+    DetectorAction::Tally total;
+    detail::accumulate_tally(tally, &total);
+    detail::accumulate_tally(DetectorAction::Tally{}, &total);
+    detail::accumulate_tally(tally, &total);
+    static real_type const expected_total_count[] = {5.0, 4.0};
+    EXPECT_VEC_SOFT_EQ(expected_total_count, total.count);
+    static real_type const expected_total_overflow[] = {2, 0};
+    EXPECT_VEC_SOFT_EQ(expected_total_overflow, total.overflow);
+}
+
+TEST_F(DetectorActionTest, host)
+{
+    CoreState<MemSpace::host> state{*optical_, StreamId{0}, 5};
+
+    // Two photons entering the sensor from different events, one entering
+    // the world, one inside the sensor that isn't crossing a boundary, and
+    // one arriving after the end of the histogram
+    this->init_track(state, TrackSlotId{0}, {1, 0, 0}, EventId{0}, 1.0);
+    this->init_track(state, TrackSlotId{1}, {100, 0, 0}, EventId{0}, 1.0);
+    this->init_track(state, TrackSlotId{2}, {0, 1, 0}, EventId{1}, 0.5);
+    this->init_track(state,
+                     TrackSlotId{3},
+                     {0, 0, 1},
+                     EventId{1},
+                     1.0,
+                     /* on_boundary = */ false);
+    this->init_track(state,
+                     TrackSlotId{4},
+                     {0, 0, -1},
+                     EventId{1},
+                     2.0,
+                     /* on_boundary = */ true,
+                     10 * units::nanosecond);
+
+    action_->step(*optical_, state);
+
+    // Detected photons are absorbed
+    auto const& status = state.ref().sim.status;
+    EXPECT_EQ(TrackStatus::killed, status[TrackSlotId{0}]);
+    EXPECT_EQ(TrackStatus::alive, status[TrackSlotId{1}]);
+    EXPECT_EQ(TrackStatus::killed, status[TrackSlotId{2}]);
+    EXPECT_EQ(TrackStatus::alive, status[TrackSlotId{3}]);
+    EXPECT_EQ(TrackStatus::killed, status[TrackSlotId{4}]);
+
+    // Compacted hits are passed to the callback with their event IDs
+    ASSERT_EQ(3, hits_.size());
+    EXPECT_EQ(EventId{0}, hits_[0].event);
+    EXPECT_EQ(EventId{1}, hits_[1].event);
+    EXPECT_SOFT_EQ(0.5, hits_[1].weight);
+    EXPECT_EQ(EventId{1}, hits_[2].event);
+
+    // Tallies are reduced per event and over the run
+    auto tally = action_->take_event(EventId{1});
+    static real_type const expected_event_count[] = {2.5};
+    EXPECT_VEC_SOFT_EQ(expected_event_count, tally.count);
+    static real_type const expected_event_hist[] = {0.5, 0};
+    EXPECT_VEC_SOFT_EQ(expected_event_hist, tally.time_hist);
+    static real_type const expected_event_overflow[] = {2.0};
+    EXPECT_VEC_SOFT_EQ(expected_event_overflow, tally.overflow);
+    EXPECT_TRUE(action_->take_event(EventId{1}).count.empty());
+
+    static real_type const expected_run_count[] = {3.5};
+    EXPECT_VEC_SOFT_EQ(expected_run_count, action_->calc_counts());
+    static real_type const expected_run_hist[] = {1.5, 0};
+    EXPECT_VEC_SOFT_EQ(expected_run_hist, action_->calc_time_histograms());
+    static real_type const expected_run_overflow[] = {2.0};
+    EXPECT_VEC_SOFT_EQ(expected_run_overflow, action_->calc_overflow());
+
+    // Hits are cleared at the next step
+    hits_.clear();
+    action_->step(*optical_, state);
+    EXPECT_EQ(0, hits_.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace optical
+}  // namespace celeritas
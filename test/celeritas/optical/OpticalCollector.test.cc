@@ -22,9 +22,11 @@
 #include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
 #include "celeritas/em/params/UrbanMscParams.hh"
+#include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/optical/CoreState.hh"
+#include "celeritas/optical/MaterialParams.hh"
 #include "celeritas/optical/detail/OffloadParams.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -442,6 +444,36 @@ TEST_F(LArSphereOffloadTest, TEST_IF_CELER_DEVICE(device_distributions))
     }
 }
 
+TEST_F(LArSphereOffloadTest, material_options)
+{
+    optical::MaterialParams::ImportOptions opts;
+    opts.survival_probability = {{"lAr", 0.25}};
+    opts.kill_volumes = {"world"};
+    auto material = optical::MaterialParams::from_import(this->imported_data(),
+                                                         *this->geometry(),
+                                                         *this->geomaterial(),
+                                                         *this->material(),
+                                                         opts);
+    auto const& data = material->host_ref();
+
+    ASSERT_EQ(1, data.survival_probability.size());
+    EXPECT_REAL_EQ(0.25, data.survival_probability[OpticalMaterialId{0}]);
+
+    auto const& geo = *this->geometry();
+    ASSERT_EQ(geo.num_volumes(), data.kill_volume.size());
+    EXPECT_TRUE(data.kill_volume[geo.find_volume("world")]);
+    EXPECT_FALSE(data.kill_volume[geo.find_volume("sphere")]);
+
+    // Unknown names are errors
+    opts.kill_volumes = {"detector"};
+    EXPECT_THROW(optical::MaterialParams::from_import(this->imported_data(),
+                                                      geo,
+                                                      *this->geomaterial(),
+                                                      *this->material(),
+                                                      opts),
+                 RuntimeError);
+}
+
 TEST_F(LArSphereOffloadTest, cerenkov_distributiona)
 {
     use_scintillation_ = false;
@@ -248,6 +248,48 @@ TEST_F(MaterialScintillationTest, pre_generator)
     EXPECT_VEC_EQ(post_pos_, result.points[StepPoint::post].pos);
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(MaterialScintillationTest, thinned)
+{
+    auto const params = this->build_scintillation_params();
+    auto const& data = params->host_ref();
+
+    auto particle
+        = this->make_particle_track_view(post_energy_, pdg::electron());
+    auto pre_step = this->build_pre_step();
+    pre_step.weight = 2;
+    pre_step.survival_probability = 0.25;
+
+    ScintillationOffload generate(particle,
+                                  this->make_sim_track_view(step_length_),
+                                  post_pos_,
+                                  edep_,
+                                  data,
+                                  pre_step);
+
+    Rng rng;
+    size_type num_samples = 1000;
+    size_type total_num_photons = 0;
+    for ([[maybe_unused]] auto i : range(num_samples))
+    {
+        auto const result = generate(rng);
+        if (!result)
+        {
+            continue;
+        }
+        total_num_photons += result.num_photons;
+        EXPECT_REAL_EQ(8, result.weight);
+
+        ScintillationGenerator generate_photon(data, result);
+        EXPECT_REAL_EQ(8, generate_photon(rng).weight);
+    }
+
+    // Mean number of photons is reduced from 3.75
+    EXPECT_SOFT_NEAR(0.25 * 3.75,
+                     real_type(total_num_photons) / num_samples,
+                     0.1);
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(MaterialScintillationTest, basic)
 {
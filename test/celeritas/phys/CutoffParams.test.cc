@@ -7,11 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/phys/CutoffParams.hh"
 
+#include "corecel/ScopedLogStorer.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
 #include "geocel/UnitUtils.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/RootTestBase.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/io/ImportData.hh"
 #include "celeritas/mat/ElementView.hh"
 #include "celeritas/mat/MaterialData.hh"
 #include "celeritas/mat/MaterialParams.hh"
@@ -199,6 +202,103 @@ TEST_F(CutoffParamsTest, apply_post_interaction)
     EXPECT_TRUE(cutoffs.apply(secondary));
 }
 
+TEST_F(CutoffParamsTest, tracking_cuts)
+{
+    CutoffParams::Input input;
+    input.materials = materials;
+    input.particles = particles;
+    input.cutoffs.insert(
+        {pdg::electron(),
+         {{Energy{0.5}, 0.1, Energy{1}}, {}, {Energy{0.5}, 0.1}}});
+    input.cutoffs.insert(
+        {pdg::gamma(), {{Energy{0.1}, 0.1, Energy{2}}, {}, {}}});
+    CutoffParams cutoff(input);
+
+    std::vector<real_type> tracking;
+    for (auto const pid : range(ParticleId{particles->size()}))
+    {
+        for (auto const mid : range(MaterialId{materials->size()}))
+        {
+            CutoffView cutoffs(cutoff.host_ref(), mid);
+            EXPECT_TRUE(cutoffs.has_tracking_cuts());
+            tracking.push_back(cutoffs.tracking(pid).value());
+        }
+    }
+    real_type const expected_tracking[] = {1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_VEC_SOFT_EQ(expected_tracking, tracking);
+
+    // Secondaries below the tracking cut are killed even without the
+    // post-interaction production cutoff
+    CutoffView cutoffs(cutoff.host_ref(), MaterialId{0});
+    EXPECT_FALSE(cutoffs.apply_post_interaction());
+    Secondary secondary;
+    secondary.particle_id = particles->find(pdg::electron());
+    secondary.energy = Energy{0.75};
+    EXPECT_TRUE(cutoffs.apply(secondary));
+    secondary.energy = Energy{1.5};
+    EXPECT_FALSE(cutoffs.apply(secondary));
+    secondary.particle_id = particles->find(pdg::gamma());
+    EXPECT_TRUE(cutoffs.apply(secondary));
+    secondary.particle_id = particles->find(pdg::proton());
+    EXPECT_FALSE(cutoffs.apply(secondary));
+
+    // Production cut in the last material has no tracking cut
+    CutoffView h2_cutoffs(cutoff.host_ref(), MaterialId{2});
+    secondary.particle_id = particles->find(pdg::electron());
+    secondary.energy = Energy{0.25};
+    EXPECT_FALSE(h2_cutoffs.apply(secondary));
+}
+
+TEST_F(CutoffParamsTest, import_tracking_cuts)
+{
+    ImportData data;
+    data.phys_materials.resize(materials->size());
+    for (auto i : range(data.phys_materials.size()))
+    {
+        data.phys_materials[i].geo_material_id = i;
+    }
+
+    // Region 0 has a 1 MeV user-limited energy; region 1 has none
+    data.regions.resize(2);
+    data.regions[0].min_energy = 1;
+
+    // Material 0 is shared by both regions, material 2 is only in region 0
+    auto make_volume = [](unsigned int region, unsigned int mat) {
+        ImportVolume v;
+        v.geo_material_id = mat;
+        v.region_id = region;
+        v.phys_material_id = mat;
+        return v;
+    };
+    data.volumes = {make_volume(0, 0), make_volume(1, 0), make_volume(0, 2)};
+
+    // Only electrons have the user special cuts process
+    data.particles.resize(2);
+    data.particles[0].pdg = pdg::electron().get();
+    data.particles[0].user_special_cuts = true;
+    data.particles[1].pdg = pdg::gamma().get();
+
+    ScopedLogStorer scoped_log_{&celeritas::world_logger()};
+    auto cutoff = CutoffParams::from_import(data, particles, materials);
+    static char const* const expected_log_messages[]
+        = {"Physics material 0 is shared by regions with different "
+           "user-limited minimum energies: using the lowest (0 MeV instead "
+           "of 1 MeV)"};
+    EXPECT_VEC_EQ(expected_log_messages, scoped_log_.messages());
+
+    std::vector<real_type> tracking;
+    for (auto const pid : range(ParticleId{particles->size()}))
+    {
+        for (auto const mid : range(MaterialId{materials->size()}))
+        {
+            CutoffView cutoffs(cutoff->host_ref(), mid);
+            tracking.push_back(cutoffs.tracking(pid).value());
+        }
+    }
+    real_type const expected_tracking[] = {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_VEC_SOFT_EQ(expected_tracking, tracking);
+}
+
 //---------------------------------------------------------------------------//
 
 #define CutoffParamsImportTest \
@@ -228,6 +328,7 @@ TEST_F(CutoffParamsImportTest, import_cutoffs)
             energies.push_back(cutoffs.energy(pid).value());
             ranges.push_back(to_cm(cutoffs.range(pid)));
             EXPECT_FALSE(cutoffs.apply_post_interaction());
+            EXPECT_FALSE(cutoffs.has_tracking_cuts());
         }
     }
 
@@ -8,6 +8,7 @@
 #include "Physics.test.hh"
 
 #include <limits>
+#include <string>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
@@ -140,8 +141,13 @@ TEST_F(PhysicsParamsTest, output)
     {
         GTEST_SKIP() << "Test results are based on CGS units";
     }
+
+    // Memory saved by deduplication depends on the precision
+    std::string const dedup_bytes = std::to_string(68 * sizeof(real_type));
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":231,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
+        R"json({"_category":"internal","_label":"physics","deduplicated":{"bytes":)json"
+            + dedup_bytes +
+            R"json(,"grids":34,"reals":68},"models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":163,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
         to_string(out));
 }
 
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <initializer_list>
 #include <numeric>
+#include <set>
 #include <vector>
 
 #include "corecel/cont/Span.hh"
@@ -22,6 +23,7 @@
 #include "celeritas/track/ExtendFromPrimariesAction.hh"
 #include "celeritas/track/ExtendFromSecondariesAction.hh"
 #include "celeritas/track/InitializeTracksAction.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "MockInteractAction.hh"
 #include "celeritas_test.hh"
@@ -220,6 +222,25 @@ struct MemspaceTypeString
 
 TYPED_TEST_SUITE(TrackInitTest, MemspaceTypes, MemspaceTypeString);
 
+//---------------------------------------------------------------------------//
+
+template<class T>
+class TrackInitSpillTest : public TrackInitTest<T>
+{
+  protected:
+    //! Use a small initializer queue to force spilling
+    std::shared_ptr<TrackInitParams const> build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 8;
+        input.max_events = 1;
+        input.track_order = TrackOrder::none;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
+TYPED_TEST_SUITE(TrackInitSpillTest, MemspaceTypes, MemspaceTypeString);
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -524,6 +545,76 @@ TYPED_TEST(TrackInitTest, extend_from_secondaries)
     }
 }  // namespace test
 
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(TrackInitSpillTest, spill_and_refill)
+{
+    size_type const num_tracks = 4;
+    this->build_states(num_tracks);
+    auto const& counters = this->state().counters();
+
+    std::set<int> track_ids;
+    auto record_track_ids = [this, &track_ids] {
+        auto result = RunResult::from_state(this->state());
+        track_ids.insert(result.track_ids.begin(), result.track_ids.end());
+    };
+
+    // Fill the initializer queue
+    auto primaries = this->make_primaries(8);
+    this->extend_from_primaries(make_span(primaries));
+    EXPECT_EQ(8, counters.num_initializers);
+    EXPECT_EQ(0, counters.num_spilled);
+    this->init_tracks();
+    record_track_ids();
+    EXPECT_EQ(4, counters.num_initializers);
+
+    // Each track dies and makes three secondaries: one is initialized in
+    // place, and the other eight overflow the remaining queue space
+    MockInteractAction{ActionId{1},
+                       std::vector<size_type>(num_tracks, 3),
+                       std::vector<bool>(num_tracks, false)}
+        .step(*this->core(), this->state());
+    ExtendFromSecondariesAction extend_from_secondaries{ActionId{2}};
+    extend_from_secondaries.step(*this->core(), this->state());
+    record_track_ids();
+    EXPECT_EQ(8, counters.num_initializers);
+    EXPECT_EQ(4, counters.num_spilled);
+    EXPECT_EQ(0, counters.num_vacancies);
+
+    // The oldest initializers (the remaining primaries) were spilled
+    {
+        auto result = RunResult::from_state(this->state());
+        EXPECT_TRUE(std::all_of(result.init_ids.begin(),
+                                result.init_ids.end(),
+                                [](int id) { return id >= 8; }));
+    }
+
+    // Kill all tracks without secondaries until the queue and spill drain
+    MockInteractAction kill_all{ActionId{1},
+                                std::vector<size_type>(num_tracks, 0),
+                                std::vector<bool>(num_tracks, false)};
+    std::vector<size_type> num_spilled;
+    for ([[maybe_unused]] auto i : range(4))
+    {
+        this->init_tracks();
+        record_track_ids();
+        kill_all.step(*this->core(), this->state());
+        extend_from_secondaries.step(*this->core(), this->state());
+        num_spilled.push_back(counters.num_spilled);
+    }
+    static size_type const expected_num_spilled[] = {4, 4, 0, 0};
+    EXPECT_VEC_EQ(expected_num_spilled, num_spilled);
+    EXPECT_EQ(0, counters.num_initializers);
+
+    // Every primary and secondary was eventually initialized
+    std::set<int> expected_track_ids;
+    for (auto i : range(20))
+    {
+        expected_track_ids.insert(i);
+    }
+    EXPECT_EQ(expected_track_ids, track_ids);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
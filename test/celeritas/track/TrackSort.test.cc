@@ -20,6 +20,7 @@
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/Stepper.hh"
+#include "celeritas/global/detail/ActionLaunchUtils.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -301,6 +302,37 @@ TEST_F(TestTrackPartitionEm3Stepper, host_is_partitioned)
     }
 }
 
+TEST_F(TestTrackPartitionEm3Stepper, host_launch_active)
+{
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    auto const& state
+        = dynamic_cast<CoreState<MemSpace::host> const&>(step.state());
+
+    auto const& actions = *this->core()->action_reg();
+    auto num_threads = [&](std::string const& label) {
+        auto const* action = dynamic_cast<CoreStepActionInterface const*>(
+            actions.action(actions.find_action(label)).get());
+        CELER_ASSERT(action);
+        return detail::get_action_threads(*action, *this->core(), state)
+            .size();
+    };
+
+    auto counts = step(make_span(primaries));
+    size_type num_steps = 0;
+    while (counts)
+    {
+        // Step actions only launch over active tracks, but the end of the
+        // step visits all slots to find vacancies for secondaries
+        EXPECT_EQ(counts.active, num_threads("pre-step"));
+        EXPECT_EQ(counts.active, num_threads("along-step-general-linear"));
+        EXPECT_EQ(state.size(), num_threads("extend-from-secondaries"));
+        num_steps += counts.active;
+        counts = step();
+    }
+    EXPECT_LT(0, num_steps);
+}
+
 TEST_F(TestTrackPartitionEm3Stepper,
        TEST_IF_CELER_DEVICE(device_is_partitioned))
 {
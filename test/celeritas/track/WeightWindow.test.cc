@@ -0,0 +1,196 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindow.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/WeightWindowAction.hh"
+
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/phys/PhysicsStepView.hh"
+#include "celeritas/track/SimTrackView.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class WeightWindowTest : public SimpleTestBase
+{
+  protected:
+    //! Leave room for the split copies
+    real_type secondary_stack_factor() const override { return 4; }
+
+    std::shared_ptr<WeightWindowAction>
+    make_action(real_type lower_weight, real_type upper_weight)
+    {
+        WeightWindowAction::Input inp;
+        inp.threshold[pdg::gamma()] = units::MevEnergy{4.5};
+        inp.lower_weight = lower_weight;
+        inp.upper_weight = upper_weight;
+        inp.max_split = 8;
+        return std::make_shared<WeightWindowAction>(
+            this->action_reg()->next_id(),
+            *this->particle(),
+            *this->geometry(),
+            inp);
+    }
+
+    // Create weighted primary particles with energies from 1 to 8 MeV
+    std::vector<Primary> make_primaries(size_type num_primaries) const
+    {
+        std::vector<Primary> result;
+        for (unsigned int i = 0; i < num_primaries; ++i)
+        {
+            Primary p;
+            p.particle_id = ParticleId{0};
+            p.energy = units::MevEnergy(1 + i % 8);
+            p.weight = 2;
+            p.position = {0, 0, 0};
+            p.direction = {0, 0, 1};
+            p.time = 0;
+            p.event_id = EventId{0};
+            result.push_back(p);
+        }
+        return result;
+    }
+
+    template<MemSpace M>
+    void initialize(CoreState<M>& state)
+    {
+        this->insert_primaries(
+            state, make_span(this->make_primaries(state.size())));
+        this->run("extend-from-primaries", state);
+        this->run("initialize-tracks", state);
+        this->run("pre-step", state);
+    }
+
+    template<MemSpace M>
+    void run(std::string const& label, CoreState<M>& state)
+    {
+        auto id = this->action_reg()->find_action(label);
+        CELER_VALIDATE(id, << "no action '" << label << '\'');
+        dynamic_cast<CoreStepActionInterface const&>(
+            *this->action_reg()->action(id))
+            .step(*this->core(), state);
+    }
+};
+
+TEST_F(WeightWindowTest, roulette)
+{
+    // Weight-2 tracks survive with probability 1/4
+    auto roulette = this->make_action(8, 0);
+
+    size_type const num_tracks = 256;
+    CoreState<MemSpace::host> state{*this->core(), StreamId{0}, num_tracks};
+    this->initialize(state);
+    roulette->step(*this->core(), state);
+
+    size_type num_high{0};
+    size_type num_survived{0};
+    size_type num_killed{0};
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        SimTrackView sim(
+            core()->ref<MemSpace::host>().sim, state.ref().sim, tid);
+        if (state.ref().particles.particle_energy[tid] > 4.5)
+        {
+            ++num_high;
+            EXPECT_EQ(TrackStatus::alive, sim.status());
+            EXPECT_EQ(2, sim.weight());
+        }
+        else if (sim.status() == TrackStatus::alive)
+        {
+            ++num_survived;
+            EXPECT_SOFT_EQ(8, sim.weight());
+        }
+        else
+        {
+            ++num_killed;
+            EXPECT_EQ(TrackStatus::killed, sim.status());
+            PhysicsStepView phys_step(core()->ref<MemSpace::host>().physics,
+                                      state.ref().physics,
+                                      tid);
+            EXPECT_EQ(0, phys_step.secondaries().size());
+            EXPECT_EQ(0, phys_step.energy_deposition().value());
+        }
+    }
+    EXPECT_EQ(128, num_high);
+    EXPECT_EQ(128, num_survived + num_killed);
+    // One in four rouletted tracks should survive
+    EXPECT_LT(16, num_survived);
+    EXPECT_GT(48, num_survived);
+
+    // Survivors are inside the window and are not rouletted again
+    roulette->step(*this->core(), state);
+    size_type num_alive{0};
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        if (state.ref().sim.status[tid] == TrackStatus::alive)
+        {
+            ++num_alive;
+        }
+    }
+    EXPECT_EQ(num_high + num_survived, num_alive);
+}
+
+TEST_F(WeightWindowTest, split)
+{
+    // Weight-2 tracks are split into four tracks of weight 1/2
+    auto split = this->make_action(0.125, 0.5);
+
+    size_type const num_tracks = 64;
+    CoreState<MemSpace::host> state{*this->core(), StreamId{0}, num_tracks};
+    this->initialize(state);
+    split->step(*this->core(), state);
+
+    size_type num_split{0};
+    for (auto tid : range(TrackSlotId{num_tracks}))
+    {
+        SimTrackView sim(
+            core()->ref<MemSpace::host>().sim, state.ref().sim, tid);
+        EXPECT_EQ(TrackStatus::alive, sim.status());
+        PhysicsStepView phys_step(
+            core()->ref<MemSpace::host>().physics, state.ref().physics, tid);
+        auto secondaries = phys_step.secondaries();
+        if (state.ref().particles.particle_energy[tid] > 4.5)
+        {
+            EXPECT_EQ(2, sim.weight());
+            EXPECT_EQ(0, secondaries.size());
+            continue;
+        }
+
+        ++num_split;
+        EXPECT_SOFT_EQ(0.5, sim.weight());
+        ASSERT_EQ(3, secondaries.size());
+        for (auto const& secondary : secondaries)
+        {
+            EXPECT_EQ(ParticleId{0}, secondary.particle_id);
+            EXPECT_EQ(state.ref().particles.particle_energy[tid],
+                      secondary.energy.value());
+            EXPECT_VEC_SOFT_EQ((Real3{0, 0, 1}), secondary.direction);
+        }
+    }
+    EXPECT_EQ(32, num_split);
+
+    // The copies are created with the parent's reduced weight
+    this->run("extend-from-secondaries", state);
+    ASSERT_EQ(3 * num_split, state.counters().num_initializers);
+    for (auto const& ti : state.ref().init.initializers[ItemRange<
+             TrackInitializer>{ItemId<TrackInitializer>{0},
+                               ItemId<TrackInitializer>{3 * num_split}}])
+    {
+        EXPECT_SOFT_EQ(0.5, ti.sim.weight);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -187,6 +187,53 @@ TEST_F(DetectorStepsTest, host)
     EXPECT_EQ(num_tracks, post.energy.size());
 }
 
+TEST_F(DetectorStepsTest, select_event)
+{
+    auto states = this->build_states(32);
+    // Interleave three events
+    for (auto tid : range(TrackSlotId{states.size()}))
+    {
+        states.data.event_id[tid] = EventId(tid.get() % 3);
+    }
+
+    DetectorStepOutput all_steps;
+    copy_steps(&all_steps, make_ref(states));
+
+    DetectorStepOutput output;
+    select_steps(&output, all_steps, EventId{1});
+
+    static int const expected_detector[] = {1, 0, 1, 0, 2, 0};
+    EXPECT_VEC_EQ(expected_detector, extract_ids(output.detector));
+
+    std::size_t num_tracks = 6;
+    EXPECT_EQ(num_tracks, output.track_id.size());
+    EXPECT_EQ(num_tracks, output.track_step_count.size());
+    EXPECT_EQ(num_tracks, output.energy_deposition.size());
+    EXPECT_EQ(num_tracks, output.points[StepPoint::pre].pos.size());
+    EXPECT_EQ(num_tracks, output.points[StepPoint::post].energy.size());
+    EXPECT_EQ(0, output.parent_id.size());
+    EXPECT_EQ(0, output.points[StepPoint::pre].weight.size());
+
+    // Selected steps keep their order and values
+    std::vector<int> expected_track_id;
+    for (auto i : range(all_steps.size()))
+    {
+        if (all_steps.event_id[i] == EventId{1})
+        {
+            expected_track_id.push_back(all_steps.track_id[i].get());
+        }
+    }
+    EXPECT_VEC_EQ(expected_track_id, extract_ids(output.track_id));
+    EXPECT_VEC_EQ(std::vector<int>(num_tracks, 1),
+                  extract_ids(output.event_id));
+
+    // No steps from a missing event
+    select_steps(&output, all_steps, EventId{3});
+    EXPECT_EQ(0, output.size());
+    EXPECT_EQ(0, output.track_id.size());
+    EXPECT_EQ(0, output.points[StepPoint::post].energy.size());
+}
+
 TEST_F(DetectorStepsTest, TEST_IF_CELER_DEVICE(device))
 {
     size_type constexpr num_tracks = 300;
@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file orange/Orange.test.cc
 //---------------------------------------------------------------------------//
+#include <cmath>
 #include <string>
 
 #include "corecel/Config.hh"
@@ -225,6 +226,33 @@ TEST_F(TwoVolumeTest, simple_track)
     EXPECT_EQ(SurfaceId{0}, geo.surface_id());
 }
 
+TEST_F(TwoVolumeTest, cached_safety)
+{
+    auto geo = this->make_geo_track_view();
+    geo = Initializer_t{{0.5, 0, 0}, {0, 0, 1}};
+    EXPECT_SOFT_EQ(1.0, geo.find_safety());
+
+    // Remaining radius of the safety sphere is enough for a short query
+    geo.find_next_step();
+    geo.move_internal(0.25);
+    EXPECT_SOFT_EQ(0.75, geo.find_safety(0.5));
+
+    // Query past the sphere's surface recalculates
+    real_type const actual = 1.5 - std::hypot(0.5, 0.25);
+    EXPECT_SOFT_EQ(actual, geo.find_safety(0.8));
+    EXPECT_SOFT_EQ(actual, geo.find_safety(0.5));
+
+    // Sphere is invalidated when reaching the boundary
+    geo.find_next_step();
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_TRUE(geo.is_outside());
+    geo.find_next_step();
+    geo.move_internal(0.1);
+    EXPECT_SOFT_EQ(std::hypot(0.5, sqrt_two + 0.1) - 1.5,
+                   geo.find_safety(0.05));
+}
+
 // Leaving the volume almost at a tangent, but magnetic field changes direction
 // on boundary so it ends up heading back in
 TEST_F(TwoVolumeTest, reentrant_boundary_setdir)
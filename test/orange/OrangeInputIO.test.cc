@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeInputIO.test.cc
+//---------------------------------------------------------------------------//
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "orange/OrangeInput.hh"
+#include "orange/OrangeInputIO.bin.hh"
+#include "orange/OrangeInputIO.json.hh"
+#include "orange/OrangeParams.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class OrangeInputIOTest : public ::celeritas::test::Test
+{
+  protected:
+    OrangeInput load_json(std::string const& basename)
+    {
+        std::ifstream infile(
+            this->test_data_path("orange", basename + ".org.json"));
+        CELER_VALIDATE(infile, << "failed to open " << basename);
+        OrangeInput result;
+        nlohmann::json::parse(infile).get_to(result);
+        return result;
+    }
+
+    static OrangeInput round_trip(OrangeInput const& inp)
+    {
+        std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        to_binary(ss, inp);
+        OrangeInput result;
+        from_binary(ss, result);
+        return result;
+    }
+};
+
+TEST_F(OrangeInputIOTest, round_trip)
+{
+    for (char const* basename : {"five-volumes",
+                                 "universes",
+                                 "rect-array",
+                                 "nested-rect-arrays",
+                                 "hex-array",
+                                 "testem3"})
+    {
+        SCOPED_TRACE(basename);
+        auto inp = this->load_json(basename);
+        auto result = round_trip(inp);
+        EXPECT_TRUE(result);
+        EXPECT_EQ(inp.universes.size(), result.universes.size());
+        EXPECT_EQ(nlohmann::json(inp).dump(), nlohmann::json(result).dump());
+    }
+}
+
+TEST_F(OrangeInputIOTest, params)
+{
+    OrangeParams const expected{this->load_json("universes")};
+    OrangeParams const actual{round_trip(this->load_json("universes"))};
+    EXPECT_EQ(expected.num_universes(), actual.num_universes());
+    EXPECT_EQ(expected.num_volumes(), actual.num_volumes());
+    EXPECT_EQ(expected.num_surfaces(), actual.num_surfaces());
+    EXPECT_EQ(expected.max_depth(), actual.max_depth());
+}
+
+TEST_F(OrangeInputIOTest, errors)
+{
+    {
+        SCOPED_TRACE("bad magic");
+        std::istringstream is("not an ORANGE file");
+        OrangeInput inp;
+        EXPECT_THROW(from_binary(is, inp), RuntimeError);
+    }
+    {
+        SCOPED_TRACE("truncated");
+        std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        to_binary(ss, this->load_json("universes"));
+        auto s = ss.str();
+        std::istringstream is(s.substr(0, s.size() / 2));
+        OrangeInput inp;
+        EXPECT_THROW(from_binary(is, inp), RuntimeError);
+    }
+    EXPECT_TRUE(is_orange_binary_filename("foo.org.bin"));
+    EXPECT_FALSE(is_orange_binary_filename("foo.org.json"));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -15,6 +15,7 @@
 #include "geocel/GeantGeoUtils.hh"
 #include "geocel/UnitUtils.hh"
 #include "orange/OrangeInput.hh"
+#include "orange/OrangeInputIO.bin.hh"
 
 #include "celeritas_test.hh"
 
@@ -165,6 +166,31 @@ TEST_F(ConverterTest, tilecal_plug)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(ConverterTest, binary_output)
+{
+    std::string const basename = "testem3";
+    std::string const filename = this->make_unique_filename(".org.bin");
+
+    Converter::Options opts;
+    opts.binary_output_file = filename;
+    auto result = Converter{std::move(opts)}(this->load_test_gdml(basename))
+                      .input;
+
+    std::ifstream infile(filename, std::ios::binary);
+    ASSERT_TRUE(infile) << "failed to open " << filename;
+    OrangeInput loaded;
+    from_binary(infile, loaded);
+
+    ASSERT_EQ(result.universes.size(), loaded.universes.size());
+    auto const& expected = std::get<UnitInput>(result.universes[0]);
+    auto const& actual = std::get<UnitInput>(loaded.universes[0]);
+    EXPECT_EQ(expected.volumes.size(), actual.volumes.size());
+    EXPECT_EQ(expected.surfaces.size(), actual.surfaces.size());
+    EXPECT_EQ(expected.label, actual.label);
+    EXPECT_EQ(result.tol.rel, loaded.tol.rel);
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(ConverterTest, DISABLED_arbitrary)
 {